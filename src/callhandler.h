@@ -0,0 +1,62 @@
+/**
+ * VaL::bOK <valbok@gmail.com>
+ * Created on: <10-Jun-2009 11:00:54 VaL>
+ *
+ * COPYRIGHT NOTICE: Copyright (C) 2009 VaL::bOK
+ * SOFTWARE LICENSE: GNU General Public License v2.0
+ */
+
+#ifndef CALLHANDLER_H
+#define CALLHANDLER_H
+
+#include <QtCore/QMap>
+#include <QtCore/QString>
+#include <QtCore/QStringList>
+#include <QtCore/QVariant>
+
+namespace OpenForm
+{
+
+/**
+ * Result of native handler that is applied to the form
+ */
+struct CallResult
+{
+    /**
+     * <ui> or <update> document that should be applied, empty if nothing.
+     * It is preprocessed and applied later like output of trigger commands.
+     */
+    QString Document;
+
+    /**
+     * Properties that should be changed.
+     *
+     * @key   - Object name
+     * @value - Values by property names
+     */
+    QMap< QString, QVariantMap > Properties;
+
+    CallResult(): Document(), Properties() {}
+};
+
+/**
+ * Native handler of triggers with action "call", it is registered in WindowHandler by name.
+ *
+ * @example <event signal="clicked" action="call">save {name.text} {age.value}</event>
+ *          calls handler "save" with arguments: text of "name" and value of "age".
+ */
+class CallHandler
+{
+public:
+    virtual ~CallHandler() {}
+
+    /**
+     * Handles event by handler \a name with values of input commands as \a arguments.
+     * Changes of the form should be set to \a result.
+     */
+    virtual void call( const QString &name, const QStringList &arguments, CallResult *result ) = 0;
+};
+
+} // namespace OpenForm
+
+#endif // CALLHANDLER_H
@@ -12,13 +12,31 @@
 using namespace OpenForm;
 
 /**
- * Parses commands in \a command for widget \a topLevel
+ * Parses commands in \a command for widget \a topLevel, \a arguments are values of signal arguments of \a sender
  */
-QString CommandHandler::parse( QWidget *topLevel, QString command )
+QString CommandHandler::parse( QWidget *topLevel, QString command, const QStringList &arguments, QObject *sender )
 {
     QString result;
-    InputCommandParser inputParser( topLevel );
+    InputCommandParser inputParser( topLevel, arguments, sender );
+    inputParser.setQuoteValues( this->QuoteValues );
     result = inputParser.parse( command );
 
     return result;
 }
+
+/**
+ * Parses each command of \a commands for widget \a topLevel.
+ * Widgets and properties are shared between commands, so they are fetched once.
+ */
+QStringList CommandHandler::parse( QWidget *topLevel, const QStringList &commands, const QStringList &arguments, QObject *sender )
+{
+    QStringList result;
+    InputCommandParser inputParser( topLevel, arguments, sender );
+    inputParser.setQuoteValues( this->QuoteValues );
+    for ( int i = 0; i < commands.size(); ++i )
+    {
+        result.append( inputParser.parse( commands.at( i ) ) );
+    }
+
+    return result;
+}
@@ -16,17 +16,23 @@
 
 #include <QWidget>
 #include <QString>
+#include <QStringList>
 
 namespace OpenForm
 {
 
 class CommandHandler
 {
+    /**
+     * If values of commands are quoted for /bin/sh
+     */
+    bool QuoteValues;
 
 public:
-    CommandHandler() {}
+    CommandHandler( bool quoteValues = false ): QuoteValues( quoteValues ) {}
     ~CommandHandler() {}
-    QString parse( QWidget *topLevel, QString command );
+    QString parse( QWidget *topLevel, QString command, const QStringList &arguments = QStringList(), QObject *sender = 0 );
+    QStringList parse( QWidget *topLevel, const QStringList &commands, const QStringList &arguments = QStringList(), QObject *sender = 0 );
 };
 
 } // namespace OpenForm
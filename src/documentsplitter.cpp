@@ -0,0 +1,257 @@
+/**
+ * VaL::bOK <valbok@gmail.com>
+ * Created on: <10-Jun-2009 11:00:54 VaL>
+ *
+ * COPYRIGHT NOTICE: Copyright (C) 2009 VaL::bOK
+ * SOFTWARE LICENSE: GNU General Public License v2.0
+ */
+
+#include "documentsplitter.h"
+#include "preprocessor.h"
+#include <cstring>
+
+using namespace OpenForm;
+
+/**
+ * Appends received \a data
+ */
+void DocumentSplitter::append( const QByteArray &data )
+{
+    this->Buffer.append( data );
+}
+
+/**
+ * Checks if \a str is at current position.
+ * Returns 1 if it is, 0 if it is not and -1 if there is not enough data to check.
+ */
+int DocumentSplitter::match( const char *str ) const
+{
+    const int length = strlen( str );
+    const int available = qMin( length, this->Buffer.size() - this->Pos );
+
+    if ( qstrncmp( this->Buffer.constData() + this->Pos, str, available ) )
+    {
+        return 0;
+    }
+
+    return available < length ? -1 : 1;
+}
+
+/**
+ * Changes depth by the tag that is finished at current position
+ */
+void DocumentSplitter::finishTag()
+{
+    if ( this->Buffer.at( this->TagBegin + 1 ) == '/' )
+    {
+        --this->Depth;
+    }
+    else if ( this->Buffer.at( this->Pos - 1 ) != '/' )
+    {
+        ++this->Depth;
+    }
+}
+
+/**
+ * Fetches next completely received document or query to \a item.
+ * Returns false if there is no complete item yet.
+ */
+bool DocumentSplitter::next( ItemType *type, QByteArray *item )
+{
+    const char newLine = Reserved::NEWLINE.toLatin1();
+
+    while ( this->Pos < this->Buffer.size() )
+    {
+        const char c = this->Buffer.at( this->Pos );
+
+        // Comments are skipped in any state like preprocessor does
+        if ( c == Reserved::COMMENT.toLatin1() && this->CurrentState != QueryLine )
+        {
+            int end = this->Buffer.indexOf( newLine, this->Pos );
+            if ( end < 0 )
+            {
+                return false;
+            }
+
+            this->Pos = end;
+            continue;
+        }
+
+        switch ( this->CurrentState )
+        {
+            case Text:
+            {
+                if ( c == '?' && this->Depth == 0 && this->Begin < 0 )
+                {
+                    this->Begin = this->Pos;
+                    this->CurrentState = QueryLine;
+                    break;
+                }
+
+                if ( c != '<' )
+                {
+                    break;
+                }
+
+                int comment = this->match( "<!--" );
+                int cdata = this->match( "<![CDATA[" );
+                int instruction = this->match( "<?" );
+                int declaration = this->match( "<!" );
+                if ( comment < 0 || cdata < 0 || instruction < 0 || declaration < 0 )
+                {
+                    return false;
+                }
+
+                // Prolog and comments before root element belong to the document
+                if ( this->Begin < 0 )
+                {
+                    this->Begin = this->Pos;
+                }
+
+                if ( comment )
+                {
+                    this->CurrentState = Comment;
+                    this->Pos += 3;
+                }
+                else if ( cdata )
+                {
+                    this->CurrentState = CData;
+                    this->Pos += 8;
+                }
+                else if ( instruction )
+                {
+                    this->CurrentState = Instruction;
+                    ++this->Pos;
+                }
+                else if ( declaration )
+                {
+                    // <!DOCTYPE ...> does not open an element
+                    this->CurrentState = Declaration;
+                    ++this->Pos;
+                }
+                else
+                {
+                    this->TagBegin = this->Pos;
+                    this->CurrentState = Tag;
+                }
+            } break;
+
+            case Tag:
+            {
+                if ( c == '"' || c == '\'' )
+                {
+                    this->QuoteChar = c;
+                    this->CurrentState = Quote;
+                }
+                else if ( c == '>' )
+                {
+                    this->CurrentState = Text;
+                    this->finishTag();
+
+                    // Root element is closed
+                    if ( this->Depth <= 0 )
+                    {
+                        *type = Document;
+                        *item = this->Buffer.mid( this->Begin, this->Pos + 1 - this->Begin );
+
+                        this->Buffer.remove( 0, this->Pos + 1 );
+                        this->Pos = 0;
+                        this->Begin = -1;
+                        this->Depth = 0;
+
+                        return true;
+                    }
+                }
+            } break;
+
+            case Quote:
+            {
+                if ( c == this->QuoteChar )
+                {
+                    this->CurrentState = Tag;
+                }
+            } break;
+
+            case Comment:
+            case CData:
+            case Instruction:
+            {
+                const char *end = this->CurrentState == Comment ? "-->" : ( this->CurrentState == CData ? "]]>" : "?>" );
+                if ( c != end[0] )
+                {
+                    break;
+                }
+
+                int found = this->match( end );
+                if ( found < 0 )
+                {
+                    return false;
+                }
+
+                if ( found )
+                {
+                    this->Pos += strlen( end ) - 1;
+                    this->CurrentState = Text;
+                }
+            } break;
+
+            case Declaration:
+            {
+                if ( c == '[' )
+                {
+                    this->CurrentState = DeclarationSubset;
+                }
+                else if ( c == '>' )
+                {
+                    this->CurrentState = Text;
+                }
+            } break;
+
+            case DeclarationSubset:
+            {
+                // Internal subset may contain '>' of its own declarations
+                if ( c == ']' )
+                {
+                    this->CurrentState = Declaration;
+                }
+            } break;
+
+            case QueryLine:
+            {
+                if ( c != newLine )
+                {
+                    break;
+                }
+
+                *type = Query;
+                *item = this->Buffer.mid( this->Begin + 1, this->Pos - this->Begin - 1 ).trimmed();
+
+                this->Buffer.remove( 0, this->Pos + 1 );
+                this->Pos = 0;
+                this->Begin = -1;
+                this->CurrentState = Text;
+
+                return true;
+            }
+        }
+
+        ++this->Pos;
+    }
+
+    // Data between items is not needed anymore
+    if ( this->Begin < 0 && this->CurrentState == Text )
+    {
+        this->Buffer.remove( 0, this->Pos );
+        this->Pos = 0;
+    }
+
+    return false;
+}
+
+/**
+ * Checks if there is no started but unfinished item
+ */
+bool DocumentSplitter::isEmpty() const
+{
+    return this->Begin < 0;
+}
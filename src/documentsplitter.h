@@ -0,0 +1,102 @@
+/**
+ * VaL::bOK <valbok@gmail.com>
+ * Created on: <10-Jun-2009 11:00:54 VaL>
+ *
+ * COPYRIGHT NOTICE: Copyright (C) 2009 VaL::bOK
+ * SOFTWARE LICENSE: GNU General Public License v2.0
+ */
+
+#ifndef DOCUMENTSPLITTER_H
+#define DOCUMENTSPLITTER_H
+
+#include <QtCore/QByteArray>
+
+namespace OpenForm
+{
+
+/**
+ * This class contains methods to split a stream of data into separate UI documents like <ui> or <update>.
+ *
+ * A document is finished when its root element is closed, so documents do not need any other framing.
+ * Lines starting with '?' between documents are queries, e.g. "?{edit.text}".
+ * Text from '#' to the end of line is a comment as it is for preprocessor.
+ */
+class DocumentSplitter
+{
+public:
+    /**
+     * Types of fetched items
+     */
+    enum ItemType
+    {
+        Document,
+        Query
+    };
+
+private:
+    /**
+     * States of scanning
+     */
+    enum State
+    {
+        Text,
+        Tag,
+        Quote,
+        Comment,
+        CData,
+        Instruction,
+        Declaration,
+        DeclarationSubset,
+        QueryLine
+    };
+
+    /**
+     * Received data that is not fetched yet
+     */
+    QByteArray Buffer;
+
+    /**
+     * Position in Buffer where scanning is continued
+     */
+    int Pos;
+
+    /**
+     * Position where current item begins, -1 if no item is started
+     */
+    int Begin;
+
+    /**
+     * Position where current tag begins
+     */
+    int TagBegin;
+
+    /**
+     * Depth of elements in current document
+     */
+    int Depth;
+
+    /**
+     * Current state
+     */
+    State CurrentState;
+
+    /**
+     * Quote char of attribute value that is being read
+     */
+    char QuoteChar;
+
+    int match( const char *str ) const;
+    void finishTag();
+
+public:
+    DocumentSplitter(): Buffer(), Pos( 0 ), Begin( -1 ), TagBegin( 0 ), Depth( 0 ), CurrentState( Text ), QuoteChar( 0 ) {}
+    ~DocumentSplitter() {}
+
+    void append( const QByteArray &data );
+    bool next( ItemType *type, QByteArray *item );
+    bool isEmpty() const;
+};
+
+} // namespace OpenForm
+
+#endif // DOCUMENTSPLITTER_H
@@ -7,6 +7,7 @@
  */
 
 #include "inputcommandparser.h"
+#include "widgetsnapshot.h"
 #include <QTextStream>
 
 using namespace OpenForm;
@@ -52,7 +53,7 @@ QString InputCommandParser::parse( const QString &input )
             if ( fetchCommand )
             {
                 fetchCommand = false;
-                result += this->parseCommand( commandItem );
+                result += this->QuoteValues ? InputCommandParser::shellQuote( this->parseCommand( commandItem ) ) : this->parseCommand( commandItem );
                 commandItem = QString();
                 continue;
             }
@@ -83,6 +84,67 @@ QString InputCommandParser::parse( const QString &input )
     return result;
 }
 
+/**
+ * Returns \a value as one single quoted word for /bin/sh, e.g. it's -> 'it'\''s'
+ */
+QString InputCommandParser::shellQuote( const QString &value )
+{
+    QString result = value;
+    return "'" + result.replace( "'", "'\\''" ) + "'";
+}
+
+InputCommandParser::~InputCommandParser()
+{
+    qDeleteAll( this->DomCache );
+    delete this->Loader;
+}
+
+/**
+ * Returns widget by \a name, each name is searched once per parser
+ */
+QWidget *InputCommandParser::cachedWidget( const QString &name )
+{
+    QHash< QString, QWidget* >::const_iterator it = this->WidgetCache.constFind( name );
+    if ( it != this->WidgetCache.constEnd() )
+    {
+        return it.value();
+    }
+
+    QWidget *widget = UiLoader::widgetByName( this->Widget, name );
+    this->WidgetCache.insert( name, widget );
+
+    return widget;
+}
+
+/**
+ * Returns dom of \a object that contains only property \a propertyName, each property is computed once per parser
+ */
+const DomWidget *InputCommandParser::cachedDom( QObject *object, const QString &widgetName, const QString &propertyName )
+{
+    const QString key = widgetName + CommandElements::SEPARATOR + propertyName;
+    QHash< QString, DomWidget* >::const_iterator it = this->DomCache.constFind( key );
+    if ( it != this->DomCache.constEnd() )
+    {
+        return it.value();
+    }
+
+    if ( !this->Loader )
+    {
+        this->Loader = new UiLoader;
+    }
+
+    // Only requested property is decoded, dom of whole widget and its children is not needed
+    DomWidget *ui_widget = new DomWidget;
+    if ( DomProperty *ui_property = this->Loader->computeProperty( object, propertyName ) )
+    {
+        ui_widget->setElementProperty( QList< DomProperty* >() << ui_property );
+    }
+
+    this->DomCache.insert( key, ui_widget );
+
+    return ui_widget;
+}
+
 /**
  * Produces bad result if error
  */
@@ -102,6 +164,20 @@ QString InputCommandParser::parseCommand( const QString &command )
         return badResult;
     }
 
+    // Signal arguments do not need any lookup
+    if ( command.startsWith( CommandElements::ARGUMENT ) )
+    {
+        bool ok = false;
+        const int index = command.mid( 1 ).toInt( &ok );
+        if ( !ok || index < 1 || index > this->Arguments.size() )
+        {
+            fprintf( stderr, "Signal does not have argument '%s'\n", command.toLocal8Bit().constData() );
+            return badResult;
+        }
+
+        return this->Arguments.at( index - 1 );
+    }
+
     QString item;
     // List of parsed items like widget name, property name etc
     QStringList commandItemList;
@@ -127,6 +203,12 @@ QString InputCommandParser::parseCommand( const QString &command )
     QString widgetName = commandItemList.size() >= 1 ? commandItemList.at( 0 ) : QString();
     QString propertyName = commandItemList.size() >= 2 ? commandItemList.at( 1 ) : QString();
 
+    // Values of all widgets are collected at once, e.g. {*} or {groupBox.*.json}
+    if ( widgetName == CommandElements::ALL )
+    {
+        return this->parseSnapshot( command, this->Widget, propertyName );
+    }
+
     if ( widgetName.isEmpty() )
     {
         fprintf( stderr, "Widget name is not provided in command '%s'\n", command.toLocal8Bit().constData() );
@@ -139,29 +221,57 @@ QString InputCommandParser::parseCommand( const QString &command )
         return badResult;
     }
 
-    UiLoader loader;
-
-    QWidget *widget = UiLoader::widgetByName( this->Widget, widgetName );
+    // Object that emitted the signal is used for {sender.PROPERTY}
+    QObject *object = ( widgetName == CommandElements::SENDER && this->Sender ) ? this->Sender : this->cachedWidget( widgetName );
 
-    if ( !widget )
+    if ( !object )
     {
         fprintf( stderr, "Could not find widget by name '%s'\n", widgetName.toLocal8Bit().constData() );
         return badResult;
     }
 
-    DomWidget *ui_widget = loader.createDom( widget, 0 );
+    if ( propertyName == CommandElements::ALL )
+    {
+        return this->parseSnapshot( command, qobject_cast< QWidget* >( object ), commandItemList.size() >= 3 ? commandItemList.at( 2 ) : QString() );
+    }
 
-    if ( !ui_widget )
+    // Dynamic properties are not stored in dom, so their values are returned as they are
+    const QByteArray propertyKey = propertyName.toUtf8();
+    if ( object->metaObject()->indexOfProperty( propertyKey.constData() ) < 0 && object->dynamicPropertyNames().contains( propertyKey ) )
     {
-        fprintf( stderr, "Could not create dom by widget\n" );
-        return badResult;
+        return object->property( propertyKey.constData() ).toString();
     }
 
     // Parse properties
-    PropertyElementParser elementParser( ui_widget, &command, &widgetName, &propertyName, &commandItemList );
-    QString result = elementParser.parse();
+    PropertyElementParser elementParser( this->cachedDom( object, widgetName, propertyName ), &command, &widgetName, &propertyName, &commandItemList );
+
+    return elementParser.parse();
+}
 
-    delete ui_widget;
+/**
+ * Fetches values of all named widgets of \a widget and its children in one pass.
+ * \a formatName is "keyvalue" ( default ) or "json".
+ */
+QString InputCommandParser::parseSnapshot( const QString &command, QWidget *widget, const QString &formatName )
+{
+    if ( !widget )
+    {
+        fprintf( stderr, "Values could be fetched for widgets only in command '%s'\n", command.toLocal8Bit().constData() );
+        return InputCommandParser::badResult( command );
+    }
+
+    WidgetSnapshot::Format format = WidgetSnapshot::KeyValue;
+    if ( !formatName.isEmpty() && !WidgetSnapshot::formatByName( formatName, &format ) )
+    {
+        fprintf( stderr, "Unsupported snapshot format '%s' in command '%s'\n", formatName.toLocal8Bit().constData(), command.toLocal8Bit().constData() );
+        return InputCommandParser::badResult( command );
+    }
+
+    QString result = QString::fromUtf8( WidgetSnapshot::collect( widget, QStringList(), format ) );
+    if ( result.endsWith( '\n' ) )
+    {
+        result.chop( 1 );
+    }
 
     return result;
 }
@@ -10,6 +10,7 @@
 #define INPUTCOMMANDPARSER_H
 
 #include <QWidget>
+#include <QtCore/QHash>
 #include "uiloader.h"
 #include "ui4_p.h"
 
@@ -25,25 +26,73 @@ namespace CommandElements
     const QChar CLOSED    = '}';
     const QChar ESCAPED   = '\\';
     const QChar SEPARATOR = '.';
+    const QChar ALL       = '*';
+    const QChar ARGUMENT  = '$';
+
+    /**
+     * Name of object that emitted the signal
+     */
+    const QString SENDER  = "sender";
 }; // namespace CommandElements
 
 /**
  * This class contains methods to fetch user input data.
  *
  * @example {edit.text} It means from widget with name 'edit' fetch content of property 'text'.
+ * @example {$1} It means value of the first argument of emitted signal.
+ * @example {sender.objectName} It means name of object that emitted the signal.
+ * @example {groupBox.*.json} It means fetch values of all named widgets inside 'groupBox' as JSON object.
  */
 class InputCommandParser
 {
+    Q_DISABLE_COPY( InputCommandParser )
+
     QWidget *Widget;
 
+    /**
+     * Values of arguments of emitted signal
+     */
+    const QStringList Arguments;
+
+    /**
+     * Object that emitted the signal
+     */
+    QObject *Sender;
+
+    /**
+     * Loader to compute properties, created when it is needed first time
+     */
+    UiLoader *Loader;
+
+    /**
+     * Widgets found by names during current parsing
+     */
+    QHash< QString, QWidget* > WidgetCache;
+
+    /**
+     * Doms with computed property by "widget.property" keys, so sub elements like {w.geometry.x} and {w.geometry.y} are computed once
+     */
+    QHash< QString, DomWidget* > DomCache;
+
+    /**
+     * If values of commands are quoted for /bin/sh
+     */
+    bool QuoteValues;
+
+    QWidget *cachedWidget( const QString &name );
+    const DomWidget *cachedDom( QObject *object, const QString &widgetName, const QString &propertyName );
     QString parseCommand( const QString &command );
+    QString parseSnapshot( const QString &command, QWidget *widget, const QString &formatName );
 
 public:
-    InputCommandParser( QWidget *widget ): Widget( widget ) {}
-    ~InputCommandParser() {}
+    InputCommandParser( QWidget *widget, const QStringList &arguments = QStringList(), QObject *sender = 0 ):
+     Widget( widget ), Arguments( arguments ), Sender( sender ), Loader( 0 ), QuoteValues( false ) {}
+    ~InputCommandParser();
     QString parse( const QString &input );
+    void setQuoteValues( bool quote ) { this->QuoteValues = quote; }
 
     static inline QString badResult( const QString &command );
+    static QString shellQuote( const QString &value );
 };
 
 #define USAGE      QString( "Use one of the following:\n" )
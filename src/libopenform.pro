@@ -0,0 +1,41 @@
+######################################################################
+# Shared library of Open Form core with C API ( openform_c.h )
+######################################################################
+
+TEMPLATE = lib
+TARGET = openform
+VERSION = 0.0.2
+DEPENDPATH += .
+INCLUDEPATH += .
+LIBS += -lQtDesigner
+
+# Input
+HEADERS += callhandler.h \
+           commandhandler.h \
+           inputcommandparser.h \
+           openform_c.h \
+           preprocessor.h \
+           shellworker.h \
+           signaldispatcher.h \
+           spawnprocess.h \
+           trigger.h \
+           ui4_p.h \
+           uicache.h \
+           uiloader.h \
+           uiparser.h \
+           widgetsnapshot.h \
+           windowhandler.h
+SOURCES += commandhandler.cpp \
+           inputcommandparser.cpp \
+           openform_c.cpp \
+           preprocessor.cpp \
+           shellworker.cpp \
+           signaldispatcher.cpp \
+           spawnprocess.cpp \
+           trigger.cpp \
+           ui4.cpp \
+           uicache.cpp \
+           uiloader.cpp \
+           uiparser.cpp \
+           widgetsnapshot.cpp \
+           windowhandler.cpp
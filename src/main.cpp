@@ -14,8 +14,14 @@
 #include <QtCore/QFile>
 #include <QtCore/QFileInfo>
 #include <QtCore/QDir>
+#include <QtCore/QScopedPointer>
+#include <QtCore/QVector>
 
 #include "windowhandler.h"
+#include "uiserver.h"
+#include "uiclient.h"
+#include "uicontrol.h"
+#include "uistream.h"
 
 #define OPENFORM_VERSION "0.0.2"
 #define OPENFORM_VERSION_STR "Open Form version %s\n", OPENFORM_VERSION
@@ -29,14 +35,52 @@ void showHelp( const char *appName )
     fprintf( stderr, "Usage: %s [options] <uifile>\n\n"
                      "  -h, -help                 display this help and exit\n"
                      "  -v, -version              display version\n"
+                     "  -cache                    cache preprocessed <uifile> and use it while the file and its includes are not changed\n"
+                     "  -daemon                   keep GUI initialized and show forms requested by other invocations\n"
+                     "  -use-daemon               show the form by running daemon of the user if it is available\n"
+                     "  -control <socket>         accept documents and queries for the form on local <socket>\n"
+                     "  -stream                   show the first document from stdin and apply next ones when they are received\n"
                      "\n", appName );
 }
 
+/**
+ * Checks if \a option is provided in command line
+ */
+bool hasOption( int argc, char *argv[], const char *option )
+{
+    for ( int i = 1; i < argc; ++i )
+    {
+        if ( !qstrcmp( argv[i], option ) )
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
 int main( int argc, char *argv[] )
 {
-    QApplication a( argc, argv );
+    bool daemon = hasOption( argc, argv, "-daemon" );
+    bool stream = hasOption( argc, argv, "-stream" );
+    // Form is shown by running daemon only if it is requested, so GUI is not initialized.
+    // Controlled or streamed form must be shown by this process.
+    bool useDaemon = hasOption( argc, argv, "-use-daemon" ) && !daemon && !stream && !hasOption( argc, argv, "-control" ) && UiClient::isDaemonRunning();
+
+    // Application may remove processed arguments from argv,
+    // so GUI is initialized by the original arguments if daemon is not available later
+    int guiArgc = argc;
+    QVector< char* > guiArgv( argc + 1 );
+    for ( int i = 0; i <= argc; ++i )
+    {
+        guiArgv[i] = argv[i];
+    }
+
+    QScopedPointer< QCoreApplication > a( useDaemon ? new QCoreApplication( argc, argv ) : new QApplication( argc, argv ) );
 
     const char *inputFile = 0;
+    const char *controlName = 0;
+    bool useCache = false;
 
     int arg = 1;
     while ( arg < argc )
@@ -52,6 +96,32 @@ int main( int argc, char *argv[] )
             fprintf( stderr, OPENFORM_VERSION_STR );
             return 0;
         }
+        else if ( opt == QLatin1String( "-cache" ) )
+        {
+            useCache = true;
+        }
+        else if ( opt == QLatin1String( "-daemon" ) )
+        {
+            daemon = true;
+        }
+        else if ( opt == QLatin1String( "-use-daemon" ) )
+        {
+            // Checked before the application is created
+        }
+        else if ( opt == QLatin1String( "-stream" ) )
+        {
+            stream = true;
+        }
+        else if ( opt == QLatin1String( "-control" ) )
+        {
+            if ( arg + 1 >= argc )
+            {
+                showHelp( argv[0] );
+                return 1;
+            }
+
+            controlName = argv[++arg];
+        }
         else if ( !inputFile )
         {
             inputFile = argv[arg];
@@ -65,6 +135,41 @@ int main( int argc, char *argv[] )
         ++arg;
     }
 
+    if ( daemon )
+    {
+        if ( inputFile )
+        {
+            showHelp( argv[0] );
+            return 1;
+        }
+
+        // Forms are closed separately, daemon is running until it is killed
+        QApplication::setQuitOnLastWindowClosed( false );
+
+        UiServer server;
+        if ( !server.listen() )
+        {
+            return 3;
+        }
+
+        return a->exec();
+    }
+
+    if ( stream )
+    {
+        if ( inputFile || controlName )
+        {
+            showHelp( argv[0] );
+            return 1;
+        }
+
+        UiStream uiStream;
+
+        return a->exec();
+    }
+
+    // Socket is relative to current path that is changed below
+    QString controlFileName = controlName ? QFileInfo( QString::fromLocal8Bit( controlName ) ).absoluteFilePath() : QString();
     QString fileName = QString::fromLocal8Bit( inputFile );
     QFile file;
 
@@ -74,7 +179,8 @@ int main( int argc, char *argv[] )
     }
     else
     {
-        file.setFileName( fileName );
+        // Absolute name is needed as current path is changed below
+        file.setFileName( QFileInfo( fileName ).absoluteFilePath() );
         if ( !file.exists() )
         {
             fprintf( stderr, "The file '%s' does not exist\n", fileName.toLocal8Bit().constData() );
@@ -92,7 +198,20 @@ int main( int argc, char *argv[] )
         QDir::setCurrent( fileInfo.path() );
     }
 
-    WindowHandler window( file );
+    if ( useDaemon )
+    {
+        int exitCode = 0;
+        if ( UiClient::run( file.fileName(), useCache, &exitCode ) )
+        {
+            return exitCode;
+        }
+
+        // Daemon is not available anymore, so GUI of this process is needed
+        a.reset();
+        a.reset( new QApplication( guiArgc, guiArgv.data() ) );
+    }
+
+    WindowHandler window( file, useCache );
     file.close();
 
     if ( !window.hasUi() )
@@ -102,7 +221,13 @@ int main( int argc, char *argv[] )
         return 4;
     }
 
+    UiControl control( &window );
+    if ( !controlFileName.isEmpty() && !control.listen( controlFileName ) )
+    {
+        return 3;
+    }
+
     window.show();
 
-    return a.exec();
+    return a->exec();
 }
@@ -6,20 +6,44 @@ TEMPLATE = app
 TARGET = 
 DEPENDPATH += .
 INCLUDEPATH += .
+QT += network
 
 # Input
-HEADERS += commandhandler.h \
+HEADERS += callhandler.h \
+           commandhandler.h \
+           documentsplitter.h \
            inputcommandparser.h \
            preprocessor.h \
+           shellworker.h \
+           signaldispatcher.h \
+           spawnprocess.h \
            trigger.h \
            ui4_p.h \
+           uicache.h \
+           uiclient.h \
+           uicontrol.h \
            uiloader.h \
+           uiparser.h \
+           uiserver.h \
+           uistream.h \
+           widgetsnapshot.h \
            windowhandler.h
 SOURCES += commandhandler.cpp \
+           documentsplitter.cpp \
            inputcommandparser.cpp \
            main.cpp \
            preprocessor.cpp \
+           shellworker.cpp \
+           signaldispatcher.cpp \
+           spawnprocess.cpp \
            trigger.cpp \
            ui4.cpp \
+           uicache.cpp \
+           uiclient.cpp \
+           uicontrol.cpp \
            uiloader.cpp \
+           uiparser.cpp \
+           uiserver.cpp \
+           uistream.cpp \
+           widgetsnapshot.cpp \
            windowhandler.cpp
@@ -0,0 +1,284 @@
+/**
+ * VaL::bOK <valbok@gmail.com>
+ * Created on: <10-Jun-2009 11:00:54 VaL>
+ *
+ * COPYRIGHT NOTICE: Copyright (C) 2009 VaL::bOK
+ * SOFTWARE LICENSE: GNU General Public License v2.0
+ */
+
+#include "openform_c.h"
+#include "windowhandler.h"
+#include "inputcommandparser.h"
+#include "callhandler.h"
+#include "uiloader.h"
+#include <QtGui/QApplication>
+#include <QtCore/QDir>
+#include <QtCore/QVector>
+#include <cstdlib>
+#include <cstring>
+
+using namespace OpenForm;
+
+/**
+ * Output of a form that passes returned data to the host
+ */
+class CallbackOutput: public QIODevice
+{
+    openform_form *Form;
+    openform_return_callback Callback;
+    void *UserData;
+
+protected:
+    qint64 readData( char *, qint64 ) { return -1; }
+    qint64 writeData( const char *data, qint64 size )
+    {
+        // Returned data is written with new line at the end like it is printed to stdout
+        if ( size > 0 && data[size - 1] == '\n' )
+        {
+            this->Callback( this->Form, data, (int) size - 1, this->UserData );
+        }
+        else
+        {
+            this->Callback( this->Form, data, (int) size, this->UserData );
+        }
+
+        return size;
+    }
+
+public:
+    CallbackOutput( openform_form *form, openform_return_callback callback, void *userData ):
+     Form( form ), Callback( callback ), UserData( userData )
+    {
+        this->open( QIODevice::WriteOnly );
+    }
+
+    bool isSequential() const { return true; }
+};
+
+/**
+ * Native handler that calls host callback
+ */
+class CallbackHandler: public CallHandler
+{
+    openform_form *Form;
+    openform_call_callback Callback;
+    void *UserData;
+
+public:
+    CallbackHandler( openform_form *form, openform_call_callback callback, void *userData ):
+     Form( form ), Callback( callback ), UserData( userData ) {}
+
+    void call( const QString &name, const QStringList &arguments, CallResult *result )
+    {
+        QList< QByteArray > values;
+        QVector< const char* > argv;
+        for ( int i = 0; i < arguments.size(); ++i )
+        {
+            values.append( arguments.at( i ).toUtf8() );
+            argv.append( values.last().constData() );
+        }
+
+        char *document = this->Callback( this->Form, name.toUtf8().constData(), argv.data(), argv.size(), this->UserData );
+        if ( !document )
+        {
+            return;
+        }
+
+        result->Document = QString::fromUtf8( document );
+        free( document );
+    }
+};
+
+struct openform_form
+{
+    WindowHandler *Window;
+    CallbackOutput *Output;
+};
+
+/**
+ * Initializes GUI if the host has not done it yet.
+ * \a argc and \a argv must be valid while the library is used.
+ */
+int openform_init( int *argc, char **argv )
+{
+    if ( !QApplication::instance() )
+    {
+        new QApplication( *argc, argv );
+    }
+
+    return qobject_cast< QApplication* >( QApplication::instance() ) ? 1 : 0;
+}
+
+/**
+ * Runs GUI event loop until the last window is closed
+ */
+int openform_exec( void )
+{
+    return QApplication::exec();
+}
+
+/**
+ * Processes pending GUI events, e.g. for hosts that have their own event loop
+ */
+void openform_process_events( void )
+{
+    QApplication::processEvents();
+}
+
+/**
+ * Loads form from \a data of \a size bytes ( -1 if \a data is 0 terminated ).
+ * Included files and trigger commands are searched in \a workingDirectory or in current one if it is 0.
+ * Returns 0 if the form could not be loaded.
+ */
+openform_form *openform_load( const char *data, int size, const char *workingDirectory )
+{
+    if ( !data )
+    {
+        return 0;
+    }
+
+    // Current directory of the host is not changed, the form keeps its own one
+    QString directory;
+    if ( workingDirectory )
+    {
+        directory = QDir( QString::fromUtf8( workingDirectory ) ).absolutePath();
+    }
+
+    WindowHandler *window = new WindowHandler( QString::fromUtf8( data, size ), directory );
+    if ( !window->hasUi() )
+    {
+        delete window;
+        return 0;
+    }
+
+    openform_form *form = new openform_form;
+    form->Window = window;
+    form->Output = 0;
+
+    return form;
+}
+
+/**
+ * Applies <ui> or <update> document, it is parsed in background and applied by event loop
+ */
+void openform_update( openform_form *form, const char *data, int size )
+{
+    if ( !form || !data )
+    {
+        return;
+    }
+
+    form->Window->setUiFrom( QString::fromUtf8( data, size ) );
+}
+
+/**
+ * Shows the form
+ */
+void openform_show( openform_form *form )
+{
+    if ( form )
+    {
+        form->Window->show();
+    }
+}
+
+/**
+ * Checks if the form is shown
+ */
+int openform_is_visible( const openform_form *form )
+{
+    return form && form->Window->hasUi() && form->Window->getWidget()->isVisible() ? 1 : 0;
+}
+
+/**
+ * Returns \a input where input commands like {edit.text} are replaced by values of widgets
+ */
+char *openform_value( const openform_form *form, const char *input )
+{
+    if ( !form || !input )
+    {
+        return 0;
+    }
+
+    InputCommandParser parser( form->Window->getWidget() );
+    QByteArray result = parser.parse( QString::fromUtf8( input ) ).toUtf8();
+
+    char *value = (char*) malloc( result.size() + 1 );
+    if ( value )
+    {
+        memcpy( value, result.constData(), result.size() + 1 );
+    }
+
+    return value;
+}
+
+/**
+ * Sets \a callback that gets data of triggers with action "return" instead of stdout
+ */
+void openform_set_return_callback( openform_form *form, openform_return_callback callback, void *userData )
+{
+    if ( !form )
+    {
+        return;
+    }
+
+    delete form->Output;
+    form->Output = callback ? new CallbackOutput( form, callback, userData ) : 0;
+    form->Window->setOutput( form->Output );
+}
+
+/**
+ * Registers \a callback for triggers with action "call" by handler \a name, 0 removes it
+ */
+void openform_set_call_callback( openform_form *form, const char *name, openform_call_callback callback, void *userData )
+{
+    if ( !form || !name )
+    {
+        return;
+    }
+
+    form->Window->setCallHandler( QString::fromUtf8( name ), callback ? new CallbackHandler( form, callback, userData ) : 0 );
+}
+
+/**
+ * Sets \a property of \a object by \a value that is converted to type of the property.
+ * Returns 0 if the object is not found or the property could not be set.
+ */
+int openform_set_property( openform_form *form, const char *object, const char *property, const char *value )
+{
+    if ( !form || !object || !property || !form->Window->hasUi() )
+    {
+        return 0;
+    }
+
+    QObject *found = UiLoader::objectByName( form->Window->getWidget(), QString::fromUtf8( object ) );
+    if ( !found )
+    {
+        return 0;
+    }
+
+    return found->setProperty( property, QString::fromUtf8( value ) ) ? 1 : 0;
+}
+
+/**
+ * Closes and deletes the form
+ */
+void openform_destroy( openform_form *form )
+{
+    if ( !form )
+    {
+        return;
+    }
+
+    delete form->Window;
+    delete form->Output;
+    delete form;
+}
+
+/**
+ * Frees string returned by the library
+ */
+void openform_free( void *ptr )
+{
+    free( ptr );
+}
@@ -0,0 +1,61 @@
+/**
+ * VaL::bOK <valbok@gmail.com>
+ * Created on: <10-Jun-2009 11:00:54 VaL>
+ *
+ * COPYRIGHT NOTICE: Copyright (C) 2009 VaL::bOK
+ * SOFTWARE LICENSE: GNU General Public License v2.0
+ */
+
+/**
+ * C API of libopenform to show and control forms inside of host process.
+ *
+ * All functions must be called from the thread where openform_init() is called.
+ * Strings are UTF-8, returned strings must be freed by openform_free().
+ */
+
+#ifndef OPENFORM_C_H
+#define OPENFORM_C_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Loaded form
+ */
+typedef struct openform_form openform_form;
+
+/**
+ * Called when trigger with action "return" is handled, \a data is not 0 terminated
+ */
+typedef void ( *openform_return_callback )( openform_form *form, const char *data, int size, void *userData );
+
+/**
+ * Called for triggers with action "call" by handler \a name with values of input commands as \a arguments.
+ * Properties can be changed by openform_set_property() directly from the callback.
+ * Returns <ui> or <update> document allocated by malloc() that should be applied or 0,
+ * it is preprocessed and applied by event loop like documents of openform_update().
+ */
+typedef char *( *openform_call_callback )( openform_form *form, const char *name, const char **arguments, int count, void *userData );
+
+int openform_init( int *argc, char **argv );
+int openform_exec( void );
+void openform_process_events( void );
+
+openform_form *openform_load( const char *data, int size, const char *workingDirectory );
+void openform_update( openform_form *form, const char *data, int size );
+void openform_show( openform_form *form );
+int openform_is_visible( const openform_form *form );
+char *openform_value( const openform_form *form, const char *input );
+void openform_set_return_callback( openform_form *form, openform_return_callback callback, void *userData );
+void openform_set_call_callback( openform_form *form, const char *name, openform_call_callback callback, void *userData );
+int openform_set_property( openform_form *form, const char *object, const char *property, const char *value );
+void openform_destroy( openform_form *form );
+
+void openform_free( void *ptr );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // OPENFORM_C_H
@@ -7,27 +7,63 @@
  */
 
 #include "preprocessor.h"
-#include <QTextStream>
 #include <QRegExp>
 #include <QStringList>
+#include <QFileInfo>
+#include <QDir>
 #include <QDebug>
+#include <climits>
+#include <cstring>
 
 using namespace OpenForm;
 
-QMap< QString, QString > PreProcessor::IncludeList;
+/**
+ * Checks if \a c is a whitespace that should be trimmed
+ */
+static inline bool isSpace( char c )
+{
+    return c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+}
+
+/**
+ * Sets data from \a file, maps the file into memory if possible.
+ * Returns false if the file could not be mapped and should be read instead.
+ */
+bool PreProcessor::setData( QFile *file )
+{
+    this->FileName = file->fileName();
+
+    qint64 size = file->size();
+    uchar *map = !file->isSequential() && size > 0 && size <= INT_MAX ? file->map( 0, size ) : 0;
+    if ( !map )
+    {
+        return false;
+    }
+
+    this->Data = QByteArray::fromRawData( (const char*) map, (int) size );
+
+    return true;
+}
 
 /**
  * @overloaded
+ *
+ * Maps the file into memory if possible instead of reading it.
+ *
+ * @note Returned data might refer to the mapped memory of \a file, so it is valid until the file is closed.
  */
-QString PreProcessor::process( QFile *file )
+QByteArray PreProcessor::process( QFile *file )
 {
     if ( !file || ( !file->isOpen() && !file->open( QFile::ReadOnly | QFile::Text ) ) )
     {
-        return QString();
+        return QByteArray();
     }
 
-    this->Data = file->readAll().data();
-    this->FileName = file->fileName();
+    // Stdin or pipes could not be mapped
+    if ( !this->setData( file ) )
+    {
+        this->Data = file->readAll();
+    }
 
     return this->process();
 }
@@ -37,102 +73,191 @@ QString PreProcessor::process( QFile *file )
  */
 QString PreProcessor::process( const QString &data )
 {
-    this->Data = data.toLatin1();
+    this->Data = data.toUtf8();
+    QByteArray result = this->process();
 
-    return this->process();
+    return QString::fromUtf8( result.constData(), result.size() );
 }
 
 /**
- * Processes derictivies like comments or includes
+ * Checks if \a data does not contain any derictives and each line is already trimmed,
+ * so it can be used as is without copying.
  */
-QString PreProcessor::process()
+bool PreProcessor::isProcessed( const char *data, int size )
 {
-    QString result;
-    if ( this->Data.isEmpty() )
+    const char newLine = Reserved::NEWLINE.toLatin1();
+
+    if ( !size || data[size - 1] != newLine || memchr( data, Reserved::COMMENT.toLatin1(), size ) )
+    {
+        return false;
+    }
+
+    for ( int i = 0; i < size; ++i )
+    {
+        if ( data[i] != newLine )
+        {
+            continue;
+        }
+
+        // Whitespace at the end of previous line or at the beginning of next line
+        if ( ( i > 0 && isSpace( data[i - 1] ) ) || ( i + 1 < size && isSpace( data[i + 1] ) ) )
+        {
+            return false;
+        }
+    }
+
+    return !isSpace( data[0] );
+}
+
+/**
+ * Trims \a line, strips comments and appends the result to \a result.
+ * Returns include derective if it is found in the line or null string.
+ */
+QString PreProcessor::processLine( const char *line, int size, QByteArray &result )
+{
+    int begin = 0;
+    int end = size;
+
+    while ( begin < end && isSpace( line[begin] ) )
+    {
+        ++begin;
+    }
+
+    while ( end > begin && isSpace( line[end - 1] ) )
+    {
+        --end;
+    }
+
+    const char *commentPos = (const char*) memchr( line + begin, Reserved::COMMENT.toLatin1(), end - begin );
+    if ( !commentPos )
+    {
+        result.append( line + begin, end - begin );
+        return QString();
+    }
+
+    int commentBegin = commentPos - line;
+    result.append( line + begin, commentBegin - begin );
+
+    // Check if we found include string
+    const QByteArray include = Reserved::INCLUDE.toLatin1();
+    if ( end - commentBegin < include.size() || qstrncmp( commentPos, include.constData(), include.size() ) )
+    {
+        return QString();
+    }
+
+    // Fetch all characters from pos (where 'include' is found) to the end of the line
+    return QString::fromUtf8( commentPos, end - commentBegin );
+}
+
+/**
+ * Processes derictivies like comments or includes.
+ *
+ * Works over raw bytes of \a this->Data, only changed lines are copied.
+ */
+QByteArray PreProcessor::process()
+{
+    QByteArray result;
+    const char *data = this->Data.constData();
+    const int size = this->Data.size();
+
+    if ( !size )
     {
         return result;
     }
 
-    QString trimmedLine, tmpLine;
-    QTextStream stream( this->Data );
+    if ( PreProcessor::isProcessed( data, size ) )
+    {
+        return this->Data;
+    }
 
-    stream.setCodec( "UTF-8" );
+    const char newLine = Reserved::NEWLINE.toLatin1();
+
+    result.reserve( size );
 
     int linePos = 0;
-    while ( !stream.atEnd() )
+    int pos = 0;
+    while ( pos < size )
     {
         ++linePos;
-        tmpLine = stream.readLine().trimmed();
 
-        for ( int i = 0; i < tmpLine.length(); i++ )
-        {
-            if ( tmpLine[i] == Reserved::COMMENT )
-            {
-                // Check if we found include string
-                if ( tmpLine.mid( i, Reserved::INCLUDE.length() ) == Reserved::INCLUDE  )
-                {
-                    // Fetch all characters from pos (where 'include' is found) to the end of the line
-                    QString includeResult = this->processInclude( this->findIncludeFileName( tmpLine.mid( i ), linePos ), linePos );
-                    if ( includeResult.isEmpty() )
-                    {
-                        break;
-                    }
-
-                    trimmedLine += includeResult;
-                }
-
-                break;
-            }
+        const char *lineEnd = (const char*) memchr( data + pos, newLine, size - pos );
+        int end = lineEnd ? lineEnd - data : size;
 
-            trimmedLine += tmpLine[i];
+        QString include = PreProcessor::processLine( data + pos, end - pos, result );
+        if ( !include.isNull() )
+        {
+            result.append( this->processInclude( this->findIncludeFileName( include, linePos ), linePos ) );
         }
 
-        result += trimmedLine + Reserved::NEWLINE;
-        trimmedLine = QString();
+        result.append( newLine );
+        pos = end + 1;
     }
 
     return result;
 }
 
 /**
- * Processes include derective.
- * Returns parsed data from file \a fileName or empty string if failed
+ * Opens included file \a fileName and registers it in include list.
+ * Returns new opened file or 0 if failed
  */
-QString PreProcessor::processInclude( const QString &fileName, const int &linePos )
+QFile *PreProcessor::openInclude( const QString &fileName, const int &linePos )
 {
-    QString result;
-
     if ( fileName.isEmpty() )
     {
-        return result;
+        return 0;
     }
 
-    QFile file( fileName );
-    if ( !file.exists() )
+    QFile *file = new QFile( fileName );
+    if ( !file->exists() )
     {
         fprintf( stderr, "%s[%i]: The file '%s' does not exist\n", this->FileName.toLocal8Bit().constData(),
                  linePos, fileName.toLocal8Bit().constData() );
-        return result;
+        delete file;
+        return 0;
     }
 
-    if ( !file.open( QFile::ReadOnly | QFile::Text ) )
+    if ( !file->open( QFile::ReadOnly | QFile::Text ) )
     {
         fprintf( stderr, "%s[%i]: The file '%s' could not be opened\n", this->FileName.toLocal8Bit().constData(),
                  linePos, fileName.toLocal8Bit().constData() );
-        return result;
+        delete file;
+        return 0;
     }
 
-    QString incStr = ( !this->FileName.isEmpty() ? this->FileName: this->Data ) + "[" + QString::number( linePos ) + "]";
+    QString incStr = ( !this->FileName.isEmpty() ? this->FileName: QString::fromUtf8( this->Data.constData(), this->Data.size() ) ) + "[" + QString::number( linePos ) + "]";
 
-    if ( PreProcessor::IncludeList.contains( fileName ) && PreProcessor::IncludeList[fileName] == incStr )
+    if ( this->IncludeList->contains( fileName ) && this->IncludeList->value( fileName ) == incStr )
     {
         fprintf( stderr, "'%s' is already included in '%s'\n", fileName.toLocal8Bit().constData(), incStr.toLocal8Bit().constData() );
+        delete file;
+        return 0;
+    }
+
+    this->IncludeList->insert( fileName, incStr );
+
+    return file;
+}
+
+/**
+ * Processes include derective.
+ * Returns parsed data from file \a fileName or empty string if failed
+ */
+QByteArray PreProcessor::processInclude( const QString &fileName, const int &linePos )
+{
+    QByteArray result;
+
+    QFile *file = this->openInclude( fileName, linePos );
+    if ( !file )
+    {
         return result;
     }
 
-    PreProcessor::IncludeList[fileName] = incStr;
-    PreProcessor preProcessor;
-    result = preProcessor.process( &file ) + Reserved::NEWLINE;
+    PreProcessor preProcessor( this->IncludeList );
+    // Appending detaches result from the mapped memory of the file
+    result.append( preProcessor.process( file ) );
+    result.append( Reserved::NEWLINE.toLatin1() );
+
+    delete file;
 
     return result;
 }
@@ -208,9 +333,197 @@ QString PreProcessor::findIncludeFileName( const QString &line, const int &lineP
 }
 
 /**
- * Clears static include list
+ * Size of data that is preprocessed at once
+ */
+static const int CHUNK_SIZE = 16384;
+
+PreProcessorDevice::PreProcessorDevice( QFile *file, QObject *parent ): QIODevice( parent ), BufferPos( 0 ), Copy( 0 )
+{
+    if ( file && ( file->isOpen() || file->open( QFile::ReadOnly | QFile::Text ) ) )
+    {
+        Source *source = new Source( &this->IncludeList );
+        source->File = file;
+        // Stdin or pipes could not be mapped, so they are read line by line
+        source->ReadLines = !source->Processor.setData( file );
+
+        this->Sources.append( source );
+    }
+
+    this->open( QIODevice::ReadOnly );
+}
+
+PreProcessorDevice::PreProcessorDevice( const QString &data, QObject *parent ): QIODevice( parent ), BufferPos( 0 ), Copy( 0 )
+{
+    if ( !data.isEmpty() )
+    {
+        Source *source = new Source( &this->IncludeList );
+        source->Processor.Data = data.toUtf8();
+
+        this->Sources.append( source );
+    }
+
+    this->open( QIODevice::ReadOnly );
+}
+
+PreProcessorDevice::~PreProcessorDevice()
+{
+    while ( !this->Sources.isEmpty() )
+    {
+        this->popSource();
+    }
+}
+
+/**
+ * Fetches next line of \a source.
+ * Returns false if there is no more lines.
+ */
+bool PreProcessorDevice::nextLine( Source *source, const char **line, int *size )
+{
+    QByteArray &data = source->Processor.Data;
+
+    if ( source->Pos >= data.size() )
+    {
+        if ( !source->ReadLines )
+        {
+            return false;
+        }
+
+        data = source->File->readLine();
+        source->Pos = 0;
+
+        if ( data.isEmpty() )
+        {
+            return false;
+        }
+    }
+
+    const char *begin = data.constData() + source->Pos;
+    const char *end = (const char*) memchr( begin, Reserved::NEWLINE.toLatin1(), data.size() - source->Pos );
+
+    *line = begin;
+    *size = end ? end - begin : data.size() - source->Pos;
+    source->Pos += *size + 1;
+
+    return true;
+}
+
+/**
+ * Finishes current source
+ */
+void PreProcessorDevice::popSource()
+{
+    Source *source = this->Sources.takeLast();
+    this->Buffer.append( source->Suffix );
+
+    QFile *file = source->OwnsFile ? source->File : 0;
+    delete source;
+    delete file;
+}
+
+/**
+ * Preprocesses next chunk of data.
+ * Returns false if there is no more data.
+ */
+bool PreProcessorDevice::fill()
+{
+    const char newLine = Reserved::NEWLINE.toLatin1();
+
+    this->Buffer.clear();
+    this->BufferPos = 0;
+
+    while ( this->Buffer.size() < CHUNK_SIZE && !this->Sources.isEmpty() )
+    {
+        Source *source = this->Sources.last();
+        const char *line = 0;
+        int size = 0;
+
+        if ( !this->nextLine( source, &line, &size ) )
+        {
+            this->popSource();
+            continue;
+        }
+
+        ++source->LinePos;
+
+        QString include = PreProcessor::processLine( line, size, this->Buffer );
+        if ( !include.isNull() )
+        {
+            PreProcessor &processor = source->Processor;
+            QString fileName = processor.findIncludeFileName( include, source->LinePos );
+            if ( !fileName.isEmpty() && !this->WorkingDirectory.isEmpty() && QFileInfo( fileName ).isRelative() )
+            {
+                fileName = QDir( this->WorkingDirectory ).filePath( fileName );
+            }
+
+            if ( !fileName.isEmpty() )
+            {
+                this->IncludedFiles.append( QFileInfo( fileName ).absoluteFilePath() );
+            }
+
+            QFile *file = processor.openInclude( fileName, source->LinePos );
+
+            if ( file )
+            {
+                Source *included = new Source( &this->IncludeList );
+                included->File = file;
+                included->OwnsFile = true;
+                included->ReadLines = !included->Processor.setData( file );
+                // Included data is finished by new line as well as the line where it is included
+                included->Suffix.append( newLine );
+                included->Suffix.append( newLine );
+
+                this->Sources.append( included );
+                continue;
+            }
+        }
+
+        this->Buffer.append( newLine );
+    }
+
+    if ( this->Copy && !this->Buffer.isEmpty() )
+    {
+        this->Copy->write( this->Buffer );
+    }
+
+    return !this->Buffer.isEmpty();
+}
+
+/**
+ * Reads preprocessed data, next chunk is processed only when the previous one is read
+ */
+qint64 PreProcessorDevice::readData( char *data, qint64 maxSize )
+{
+    qint64 read = 0;
+
+    while ( read < maxSize )
+    {
+        if ( this->BufferPos >= this->Buffer.size() && !this->fill() )
+        {
+            break;
+        }
+
+        qint64 size = qMin( maxSize - read, qint64( this->Buffer.size() - this->BufferPos ) );
+        memcpy( data + read, this->Buffer.constData() + this->BufferPos, size );
+
+        read += size;
+        this->BufferPos += size;
+    }
+
+    return read;
+}
+
+/**
+ * Checks if all data is read
+ */
+bool PreProcessorDevice::atEnd() const
+{
+    return this->BufferPos >= this->Buffer.size() && this->Sources.isEmpty() && QIODevice::bytesAvailable() == 0;
+}
+
+/**
+ * Returns number of bytes that are already processed and could be read
  */
-void PreProcessor::clearIncludeList()
+qint64 PreProcessorDevice::bytesAvailable() const
 {
-    PreProcessor::IncludeList.clear();
+    return this->Buffer.size() - this->BufferPos + QIODevice::bytesAvailable();
 }
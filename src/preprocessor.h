@@ -12,6 +12,9 @@
 #include <QtCore/QFile>
 #include <QtCore/QString>
 #include <QtCore/QMap>
+#include <QtCore/QList>
+#include <QtCore/QStringList>
+#include <QtCore/QIODevice>
 
 namespace OpenForm
 {
@@ -32,16 +35,30 @@ namespace Reserved
  */
 class PreProcessor
 {
+public:
     /**
      * List of included files.
      *
      * @key   - Name of file that was included.
      * @value - From which file name/data text and line position it was included.
      */
-    static QMap< QString, QString > IncludeList;
+    typedef QMap< QString, QString > IncludeMap;
+
+private:
+    /**
+     * Included files of the document that is being processed,
+     * shared by processors of the document and its includes.
+     */
+    IncludeMap *IncludeList;
+
+    /**
+     * If \a IncludeList is created by this processor and should be deleted
+     */
+    bool OwnsIncludeList;
 
     /**
-     * Text data that should be processed
+     * Text data that should be processed.
+     * Might refer to memory mapped file without copying.
      */
     QByteArray Data;
 
@@ -50,17 +67,132 @@ class PreProcessor
      */
     QString FileName;
 
-    QString processInclude( const QString &fileName, const int &linePos );
+    bool setData( QFile *file );
+    QFile *openInclude( const QString &fileName, const int &linePos );
+    QByteArray processInclude( const QString &fileName, const int &linePos );
     QString findIncludeFileName( const QString &line, const int &linePos );
-    QString process();
+    QByteArray process();
+
+    static bool isProcessed( const char *data, int size );
+    static QString processLine( const char *line, int size, QByteArray &result );
+
+    // Allow PreProcessorDevice to process data line by line
+    friend class PreProcessorDevice;
+
+    Q_DISABLE_COPY( PreProcessor )
 
 public:
-    PreProcessor(): Data(), FileName( QString() ) { }
-    ~PreProcessor() {}
-    QString process( QFile *file );
+    PreProcessor(): IncludeList( new IncludeMap ), OwnsIncludeList( true ), Data(), FileName( QString() ) { }
+    PreProcessor( IncludeMap *includeList ): IncludeList( includeList ), OwnsIncludeList( false ), Data(), FileName( QString() ) { }
+    ~PreProcessor() { if ( this->OwnsIncludeList ) delete this->IncludeList; }
+    QByteArray process( QFile *file );
     QString process( const QString &data );
+};
+
+/**
+ * Sequential device that preprocesses data on demand while it is being read, e.g. by QXmlStreamReader.
+ * Included files are opened only when reading reaches them, so only a chunk of the document is kept in memory.
+ */
+class PreProcessorDevice: public QIODevice
+{
+    /**
+     * Data that is being processed: root data or included file
+     */
+    struct Source
+    {
+        /**
+         * Handles data of the source
+         */
+        PreProcessor Processor;
+
+        /**
+         * File where data is read from line by line if it could not be mapped
+         */
+        QFile *File;
+
+        /**
+         * If the file is included and should be deleted
+         */
+        bool OwnsFile;
+
+        /**
+         * If data should be read from the file line by line
+         */
+        bool ReadLines;
+
+        /**
+         * Position of next line in Processor.Data
+         */
+        int Pos;
+
+        /**
+         * Number of current line
+         */
+        int LinePos;
+
+        /**
+         * Data that should be added when the source is finished
+         */
+        QByteArray Suffix;
+
+        Source( PreProcessor::IncludeMap *includeList ): Processor( includeList ), File( 0 ), OwnsFile( false ), ReadLines( false ), Pos( 0 ), LinePos( 0 ), Suffix() {}
+    };
+
+    /**
+     * Stack of sources, the last one is being read
+     */
+    QList< Source* > Sources;
+
+    /**
+     * Processed data that is not read yet
+     */
+    QByteArray Buffer;
+
+    /**
+     * Position of unread data in Buffer
+     */
+    int BufferPos;
+
+    /**
+     * Device where processed data is copied to, e.g. to cache it
+     */
+    QIODevice *Copy;
+
+    /**
+     * Absolute names of files that have been included or tried to be included
+     */
+    QStringList IncludedFiles;
+
+    /**
+     * Included files of this document, each device has its own list
+     */
+    PreProcessor::IncludeMap IncludeList;
+
+    /**
+     * Directory where relative included files are searched, current directory if empty
+     */
+    QString WorkingDirectory;
+
+    bool nextLine( Source *source, const char **line, int *size );
+    void popSource();
+    bool fill();
+
+protected:
+    qint64 readData( char *data, qint64 maxSize );
+    qint64 writeData( const char *, qint64 ) { return -1; }
+
+public:
+    PreProcessorDevice( QFile *file, QObject *parent = 0 );
+    PreProcessorDevice( const QString &data, QObject *parent = 0 );
+    ~PreProcessorDevice();
+
+    bool isSequential() const { return true; }
+    bool atEnd() const;
+    qint64 bytesAvailable() const;
 
-    static void clearIncludeList();
+    void setCopy( QIODevice *device ) { this->Copy = device; }
+    void setWorkingDirectory( const QString &path ) { this->WorkingDirectory = path; }
+    QStringList getIncludedFiles() const { return this->IncludedFiles; }
 };
 
 
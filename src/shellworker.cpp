@@ -0,0 +1,260 @@
+/**
+ * VaL::bOK <valbok@gmail.com>
+ * Created on: <10-Jun-2009 11:00:54 VaL>
+ *
+ * COPYRIGHT NOTICE: Copyright (C) 2009 VaL::bOK
+ * SOFTWARE LICENSE: GNU General Public License v2.0
+ */
+
+#include "shellworker.h"
+#include "trigger.h"
+#include "inputcommandparser.h"
+#include <QtCore/QCoreApplication>
+#include <QtCore/QDateTime>
+#include <QtCore/QFile>
+#include <sys/types.h>
+#include <signal.h>
+#include <unistd.h>
+
+using namespace OpenForm;
+
+void ShellProcess::setupChildProcess()
+{
+    ::setpgid( 0, 0 );
+}
+
+/**
+ * The shell is started in \a workingDirectory with \a environment, or with environment of the application if it is empty
+ */
+ShellWorker::ShellWorker( const QString &workingDirectory, const QStringList &environment, QObject *parent, QIODevice *errorOutput ):
+ QObject( parent ), WorkingDirectory( workingDirectory ), ErrorOutput( errorOutput )
+{
+    // Commands must not be able to guess the sentinel and to fake end of output
+    QFile random( "/dev/urandom" );
+    QByteArray key;
+    if ( random.open( QIODevice::ReadOnly | QIODevice::Unbuffered ) )
+    {
+        key = random.read( 16 );
+    }
+
+    if ( key.size() == 16 )
+    {
+        this->Sentinel = "__openform_" + key.toHex() + "__";
+    }
+    else
+    {
+        fprintf( stderr, "Could not read /dev/urandom, sentinel of persistent shell is predictable\n" );
+        qsrand( uint( QDateTime::currentMSecsSinceEpoch() ) ^ uint( QCoreApplication::applicationPid() ) );
+        this->Sentinel = QString( "__openform_%1_%2_%3__" ).arg( QCoreApplication::applicationPid() )
+                                                            .arg( QDateTime::currentMSecsSinceEpoch() )
+                                                            .arg( qrand() ).toLatin1();
+    }
+
+    this->Shell.setWorkingDirectory( workingDirectory );
+    if ( !environment.isEmpty() )
+    {
+        this->Shell.setEnvironment( environment );
+    }
+
+    this->Shell.setReadChannelMode( QProcess::SeparateChannels );
+
+    connect( &this->Shell, SIGNAL( readyReadStandardOutput() ), this, SLOT( readFromStdout() ) );
+    connect( &this->Shell, SIGNAL( readyReadStandardError() ), this, SLOT( readFromStderr() ) );
+    connect( &this->Shell, SIGNAL( finished( int, QProcess::ExitStatus ) ), this, SLOT( finished( int, QProcess::ExitStatus ) ) );
+    connect( &this->Shell, SIGNAL( error( QProcess::ProcessError ) ), this, SLOT( error( QProcess::ProcessError ) ) );
+}
+
+ShellWorker::~ShellWorker()
+{
+    // Shell is killed, commands in queue are deleted by their parent
+    this->Shell.disconnect( this );
+    this->stop();
+}
+
+/**
+ * Queues \a command of \a process to the shell, \a input is passed to its stdin if provided
+ */
+void ShellWorker::execute( TriggerProcess *process, const QString &command, const QByteArray *input )
+{
+    // Command is executed in subshell, so "exit" or "cd" do not affect the next commands,
+    // and it must not read commands of the shell from stdin.
+    // It is passed to eval as one quoted word, so unbalanced quotes can not swallow the sentinel.
+    QByteArray script = "( eval " + InputCommandParser::shellQuote( command ).toLocal8Bit() + " )";
+    if ( input )
+    {
+        const QByteArray delimiter = this->Sentinel + "_input";
+        script += " <<'" + delimiter + "'\n" + *input;
+        if ( !input->endsWith( '\n' ) )
+        {
+            script += '\n';
+        }
+
+        script += delimiter + "\n";
+    }
+    else
+    {
+        script += " < /dev/null\n";
+    }
+
+    script += "printf '\\n%s %d\\n' '" + this->Sentinel + "' \"$?\"\n";
+
+    Command item;
+    item.Process = process;
+    item.Script = script;
+    this->Queue.append( item );
+
+    if ( this->Queue.size() == 1 )
+    {
+        this->writeNext();
+    }
+}
+
+/**
+ * Drops command of \a process that is deleted, the shell is restarted if the command is running
+ */
+void ShellWorker::cancel( TriggerProcess *process )
+{
+    for ( int i = this->Queue.size() - 1; i > 0; --i )
+    {
+        if ( this->Queue.at( i ).Process == process )
+        {
+            this->Queue.removeAt( i );
+        }
+    }
+
+    if ( !this->Queue.isEmpty() && this->Queue.first().Process == process )
+    {
+        this->stop();
+        this->Queue.removeFirst();
+        this->writeNext();
+    }
+}
+
+/**
+ * Writes the first command of the queue to the shell, the shell is started when it is needed
+ */
+void ShellWorker::writeNext()
+{
+    if ( this->Queue.isEmpty() )
+    {
+        return;
+    }
+
+    if ( this->Shell.state() == QProcess::NotRunning )
+    {
+        this->Buffer.clear();
+        this->Shell.start( "/bin/sh" );
+    }
+
+    this->Shell.write( this->Queue.first().Script );
+}
+
+/**
+ * Kills the shell with the command it runs, commands in queue are kept
+ */
+void ShellWorker::stop()
+{
+    if ( this->Shell.state() == QProcess::NotRunning )
+    {
+        return;
+    }
+
+    // Killed shell must not fail commands in queue
+    this->Shell.blockSignals( true );
+    if ( this->Shell.pid() > 0 )
+    {
+        ::kill( -this->Shell.pid(), SIGKILL );
+    }
+
+    this->Shell.kill();
+    this->Shell.waitForFinished();
+    this->Shell.blockSignals( false );
+    this->Buffer.clear();
+}
+
+/**
+ * Splits output of the shell by sentinels and passes it to processes of commands
+ */
+void ShellWorker::readFromStdout()
+{
+    this->Buffer += this->Shell.readAllStandardOutput();
+
+    const QByteArray marker = "\n" + this->Sentinel + " ";
+    for ( ;; )
+    {
+        const int markerIndex = this->Buffer.indexOf( marker );
+        if ( markerIndex < 0 )
+        {
+            return;
+        }
+
+        const int codeIndex = markerIndex + marker.size();
+        const int endIndex = this->Buffer.indexOf( '\n', codeIndex );
+        if ( endIndex < 0 )
+        {
+            return;
+        }
+
+        const int exitCode = this->Buffer.mid( codeIndex, endIndex - codeIndex ).toInt();
+        const QByteArray data = this->Buffer.left( markerIndex );
+        this->Buffer.remove( 0, endIndex + 1 );
+
+        if ( this->Queue.isEmpty() )
+        {
+            continue;
+        }
+
+        QPointer< TriggerProcess > process = this->Queue.takeFirst().Process;
+        if ( process )
+        {
+            process->finishInShell( exitCode, data );
+        }
+
+        this->writeNext();
+    }
+}
+
+/**
+ * Errors of commands are printed as they are
+ */
+void ShellWorker::readFromStderr()
+{
+    const QByteArray data = this->Shell.readAllStandardError();
+    if ( this->ErrorOutput )
+    {
+        this->ErrorOutput->write( data );
+    }
+    else
+    {
+        fprintf( stderr, "%s", data.constData() );
+    }
+}
+
+/**
+ * Commands that are not finished yet are failed when the shell exits
+ */
+void ShellWorker::finished( int, QProcess::ExitStatus )
+{
+    this->failAll();
+}
+
+void ShellWorker::error( QProcess::ProcessError error )
+{
+    if ( error == QProcess::FailedToStart || error == QProcess::Crashed )
+    {
+        this->failAll();
+    }
+}
+
+void ShellWorker::failAll()
+{
+    this->Buffer.clear();
+    while ( !this->Queue.isEmpty() )
+    {
+        QPointer< TriggerProcess > process = this->Queue.takeFirst().Process;
+        if ( process )
+        {
+            process->finishInShell( -1, QByteArray(), true );
+        }
+    }
+}
@@ -0,0 +1,106 @@
+/**
+ * VaL::bOK <valbok@gmail.com>
+ * Created on: <10-Jun-2009 11:00:54 VaL>
+ *
+ * COPYRIGHT NOTICE: Copyright (C) 2009 VaL::bOK
+ * SOFTWARE LICENSE: GNU General Public License v2.0
+ */
+
+#ifndef SHELLWORKER_H
+#define SHELLWORKER_H
+
+#include <QtCore/QObject>
+#include <QtCore/QByteArray>
+#include <QtCore/QList>
+#include <QtCore/QPointer>
+#include <QtCore/QStringList>
+#include <QProcess>
+
+namespace OpenForm
+{
+
+class TriggerProcess;
+
+/**
+ * Shell which leads its own process group, so commands started by the shell are killed with it
+ */
+class ShellProcess: public QProcess
+{
+protected:
+    void setupChildProcess();
+};
+
+/**
+ * This class keeps one long-lived shell and executes commands of triggers in it,
+ * so interpreter does not need to be started for each command.
+ *
+ * Each command is passed to eval in a subshell as one quoted word,
+ * its output is followed by a random sentinel with its exit code.
+ * Commands are written one at a time, the next one is written when the previous one is finished.
+ */
+class ShellWorker: public QObject
+{
+    Q_OBJECT
+
+    /**
+     * Shell where commands are executed
+     */
+    ShellProcess Shell;
+
+    /**
+     * Directory where the shell is started
+     */
+    const QString WorkingDirectory;
+
+    /**
+     * Unique marker that separates outputs of commands
+     */
+    QByteArray Sentinel;
+
+    /**
+     * Output of the shell which is not handled yet
+     */
+    QByteArray Buffer;
+
+    /**
+     * Command of a trigger and the script it is written to the shell by
+     */
+    struct Command
+    {
+        QPointer< TriggerProcess > Process;
+
+        QByteArray Script;
+    };
+
+    /**
+     * Commands in order they are executed, the first one is written to the shell
+     */
+    QList< Command > Queue;
+
+    /**
+     * Device where stderr of the shell is written, stderr of the application if 0
+     */
+    QPointer< QIODevice > ErrorOutput;
+
+    void writeNext();
+    void stop();
+    void failAll();
+
+private slots:
+
+    void readFromStdout();
+    void readFromStderr();
+    void finished( int exitCode, QProcess::ExitStatus exitStatus );
+    void error( QProcess::ProcessError error );
+
+public:
+    ShellWorker( const QString &workingDirectory, const QStringList &environment, QObject *parent, QIODevice *errorOutput = 0 );
+    ~ShellWorker();
+
+    void execute( TriggerProcess *process, const QString &command, const QByteArray *input );
+    void cancel( TriggerProcess *process );
+};
+
+} // namespace OpenForm
+
+#endif // SHELLWORKER_H
@@ -0,0 +1,294 @@
+/**
+ * VaL::bOK <valbok@gmail.com>
+ * Created on: <10-Jun-2009 11:00:54 VaL>
+ *
+ * COPYRIGHT NOTICE: Copyright (C) 2009 VaL::bOK
+ * SOFTWARE LICENSE: GNU General Public License v2.0
+ */
+
+#include "signaldispatcher.h"
+#include "windowhandler.h"
+#include "commandhandler.h"
+#include "shellworker.h"
+#include <QtCore/QMetaMethod>
+#include <QtCore/QRegExp>
+#include <QtCore/QVariant>
+
+using namespace OpenForm;
+
+/**
+ * Dynamic slots are right after slots of QObject
+ */
+static inline int slotIndex( int id )
+{
+    return QObject::staticMetaObject.methodCount() + id;
+}
+
+SignalDispatcher::SignalDispatcher( WindowHandler *windowHandler ):
+ QObject( windowHandler ), WinHandler( windowHandler ), Shell( 0 )
+{
+}
+
+/**
+ * Installs \a trigger for \a signalName of \a object, previous one for \a objectName and \a signalName is deleted
+ */
+void SignalDispatcher::setTrigger( QObject *object, const QString &objectName, const QString &signalName, const Trigger &trigger )
+{
+    this->deleteTriggers( objectName, signalName );
+
+    const int signalIndex = object->metaObject()->indexOfSignal( QMetaObject::normalizedSignature( signalName.toUtf8().constData() ) );
+    if ( signalIndex < 0 )
+    {
+        fprintf( stderr, "%s: Object does not have signal '%s'\n", objectName.toLocal8Bit().constData(), signalName.toLocal8Bit().constData() );
+        return;
+    }
+
+    int id = this->Triggers.size();
+    if ( !this->FreeSlots.isEmpty() )
+    {
+        id = this->FreeSlots.takeLast();
+    }
+    else
+    {
+        this->Triggers.append( Trigger() );
+    }
+
+    Trigger &item = this->Triggers[id];
+    item = trigger;
+    item.Sender = object;
+    item.SignalIndex = signalIndex;
+
+    const QList< QByteArray > types = object->metaObject()->method( signalIndex ).parameterTypes();
+    for ( int i = 0; i < types.size(); ++i )
+    {
+        int type = QMetaType::type( types.at( i ).constData() );
+        if ( type == QMetaType::Void )
+        {
+            fprintf( stderr, "%s::%s: Unsupported type '%s' of signal argument %i\n", objectName.toLocal8Bit().constData(),
+                     signalName.toLocal8Bit().constData(), types.at( i ).constData(), i + 1 );
+        }
+
+        item.ArgumentTypes.append( type );
+    }
+
+    QMetaObject::connect( object, signalIndex, this, slotIndex( id ) );
+    this->TriggerList[objectName][signalName] = id;
+}
+
+/**
+ * Disconnects trigger \a id and makes its slot free
+ */
+void SignalDispatcher::removeTrigger( int id )
+{
+    Trigger &item = this->Triggers[id];
+    if ( item.Sender )
+    {
+        QMetaObject::disconnect( item.Sender, item.SignalIndex, this, slotIndex( id ) );
+    }
+
+    this->stopProcesses( id );
+    item = Trigger();
+    this->FreeSlots.append( id );
+}
+
+/**
+ * Kills commands started by trigger \a id which are not finished yet
+ */
+void SignalDispatcher::stopProcesses( int id )
+{
+    const QList< QPointer< QObject > > running = this->Running.values( id );
+    this->Running.remove( id );
+    for ( int i = 0; i < running.size(); ++i )
+    {
+        // Processes of a group are its children
+        delete running.at( i );
+    }
+}
+
+/**
+ * Deletes all triggers
+ */
+void SignalDispatcher::deleteTriggers()
+{
+    for ( int i = 0; i < this->Triggers.size(); i++ )
+    {
+        const Trigger &item = this->Triggers.at( i );
+        if ( item.Sender )
+        {
+            QMetaObject::disconnect( item.Sender, item.SignalIndex, this, slotIndex( i ) );
+        }
+
+        this->stopProcesses( i );
+    }
+
+    this->Triggers.clear();
+    this->FreeSlots.clear();
+    this->TriggerList.clear();
+}
+
+/**
+ * Deletes triggers by \a objectName
+ */
+void SignalDispatcher::deleteTriggers( const QString &objectName )
+{
+    if ( !this->TriggerList.contains( objectName ) )
+    {
+        return;
+    }
+
+    const QList< int > ids = this->TriggerList.take( objectName ).values();
+    for ( int i = 0; i < ids.size(); i++ )
+    {
+        this->removeTrigger( ids.at( i ) );
+    }
+}
+
+/**
+ * Deletes triggers by \a objectName and its \a signalName
+ */
+void SignalDispatcher::deleteTriggers( const QString &objectName, const QString &signalName )
+{
+    if ( !this->TriggerList.contains( objectName ) )
+    {
+        return;
+    }
+
+    TriggerMap *triggerItems = &this->TriggerList[objectName];
+    if ( !triggerItems->contains( signalName ) )
+    {
+        return;
+    }
+
+    this->removeTrigger( triggerItems->take( signalName ) );
+}
+
+/**
+ * Converts arguments of emitted signal to strings and handles the trigger of called dynamic slot
+ */
+int SignalDispatcher::qt_metacall( QMetaObject::Call call, int id, void **arguments )
+{
+    id = QObject::qt_metacall( call, id, arguments );
+    if ( id < 0 || call != QMetaObject::InvokeMetaMethod )
+    {
+        return id;
+    }
+
+    if ( id < this->Triggers.size() && !this->Triggers.at( id ).isNull() )
+    {
+        // Handling may replace triggers, so the record is copied
+        const Trigger trigger = this->Triggers.at( id );
+
+        // arguments[0] is return value
+        QStringList values;
+        for ( int i = 0; i < trigger.ArgumentTypes.size(); ++i )
+        {
+            const int type = trigger.ArgumentTypes.at( i );
+            values.append( type == QMetaType::Void ? QString() : QVariant( type, arguments[i + 1] ).toString() );
+        }
+
+        this->handle( id, trigger, values );
+    }
+
+    return -1;
+}
+
+/**
+ * Handles \a trigger of dynamic slot \a id, \a arguments of emitted signal replace {$1}, {$2} etc and its sender replaces {sender.PROPERTY} in the command
+ */
+void SignalDispatcher::handle( int id, const Trigger &trigger, const QStringList &arguments )
+{
+    // Commands of persistent shell are interpreted by /bin/sh, so values must not be executed as its syntax
+    CommandHandler parser( trigger.PersistentShell && trigger.Action != Actions::CALL && trigger.Action != Actions::RETURN );
+
+    // Each argument is parsed separately, so values are passed as they are even if they contain whitespaces
+    if ( trigger.Action == Actions::CALL )
+    {
+        for ( int i = 0; i < trigger.Commands.size(); ++i )
+        {
+            QStringList commands = trigger.Commands.at( i ).split( QRegExp( "\\s+" ), QString::SkipEmptyParts );
+            if ( commands.isEmpty() )
+            {
+                continue;
+            }
+
+            // Handler may replace UI, so the widget is fetched for each command
+            QString name = commands.takeFirst();
+            this->WinHandler->callHandler( name, parser.parse( this->WinHandler->getWidget(), commands, arguments, trigger.Sender ) );
+        }
+
+        return;
+    }
+
+    const QStringList parsedCommands = parser.parse( this->WinHandler->getWidget(), trigger.Commands, arguments, trigger.Sender );
+
+    // Just return parsed commands to user
+    if ( trigger.Action == Actions::RETURN )
+    {
+        for ( int i = 0; i < parsedCommands.size(); ++i )
+        {
+            this->WinHandler->returnData( parsedCommands.at( i ) );
+        }
+
+        return;
+    }
+
+    // Widget values are passed as structured data, so they do not need to be quoted in the command
+    QByteArray input;
+    if ( trigger.HasInput )
+    {
+        input = WidgetSnapshot::collect( this->WinHandler->getWidget(), trigger.InputWidgets, trigger.InputFormat );
+    }
+
+    // Updates of all commands are applied together when the last one is finished
+    TriggerGroup *group = 0;
+    if ( trigger.ApplyAll && parsedCommands.size() + trigger.Pipelines.size() > 1 )
+    {
+        group = new TriggerGroup( this );
+        QObject::connect( group, SIGNAL( uiChanged( const QString & ) ), this->WinHandler, SLOT( setUiFrom( const QString & ) ) );
+    }
+
+    // Finished processes and groups are deleted by themselves
+    this->Running.remove( id, QPointer< QObject >() );
+    if ( group )
+    {
+        this->Running.insert( id, group );
+    }
+
+    // Each command is a pipeline with one stage
+    QList< QStringList > pipelines;
+    for ( int i = 0; i < parsedCommands.size(); ++i )
+    {
+        pipelines.append( QStringList() << parsedCommands.at( i ) );
+    }
+
+    for ( int i = 0; i < trigger.Pipelines.size(); ++i )
+    {
+        pipelines.append( parser.parse( this->WinHandler->getWidget(), trigger.Pipelines.at( i ), arguments, trigger.Sender ) );
+    }
+
+    // One shell of the form executes commands one by one
+    if ( trigger.PersistentShell && !this->Shell )
+    {
+        this->Shell = new ShellWorker( this->WinHandler->getWorkingDirectory(), this->WinHandler->getEnvironment(), this, this->WinHandler->getErrorOutput() );
+    }
+
+    // Commands are executed in parallel, processes exist only while the commands are executed
+    for ( int i = 0; i < pipelines.size(); ++i )
+    {
+        TriggerProcess *process = new TriggerProcess( pipelines.at( i ), this->WinHandler->getWorkingDirectory(), this, trigger.PersistentShell ? this->Shell : 0 );
+        process->setErrorOutput( this->WinHandler->getErrorOutput() );
+        process->setEnvironment( this->WinHandler->getEnvironment() );
+        if ( group )
+        {
+            group->addProcess( process );
+        }
+        else
+        {
+            // Update UI by new one
+            QObject::connect( process, SIGNAL( uiChanged( const QString & ) ), this->WinHandler, SLOT( setUiFrom( const QString & ) ) );
+            this->Running.insert( id, process );
+        }
+
+        process->start( trigger.HasInput ? &input : 0 );
+    }
+}
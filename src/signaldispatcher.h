@@ -0,0 +1,99 @@
+/**
+ * VaL::bOK <valbok@gmail.com>
+ * Created on: <10-Jun-2009 11:00:54 VaL>
+ *
+ * COPYRIGHT NOTICE: Copyright (C) 2009 VaL::bOK
+ * SOFTWARE LICENSE: GNU General Public License v2.0
+ */
+
+#ifndef SIGNALDISPATCHER_H
+#define SIGNALDISPATCHER_H
+
+#include <QtCore/QObject>
+#include <QtCore/QList>
+#include <QtCore/QMap>
+#include <QtCore/QMultiHash>
+#include <QtCore/QPointer>
+#include <QtCore/QStringList>
+#include <QtCore/QVector>
+#include "trigger.h"
+
+namespace OpenForm
+{
+
+class WindowHandler;
+class ShellWorker;
+
+/**
+ * This class receives signals of all triggers of a window handler and handles them.
+ *
+ * It does not use Q_OBJECT, instead each trigger is connected to its own dynamic slot
+ * which is handled in qt_metacall(), so one object is able to receive signals with any arguments.
+ */
+class SignalDispatcher: public QObject
+{
+    /**
+     * @key   - Event name like "clicked()"
+     * @value - Index of trigger in Triggers
+     */
+    typedef QMap< QString, int > TriggerMap;
+
+    /**
+     * @key   - Object name
+     * @value - Events for this object
+     */
+    typedef QMap< QString, TriggerMap > TriggerListMap;
+
+    /**
+     * Window handler which UI is updated by triggers
+     */
+    WindowHandler *WinHandler;
+
+    /**
+     * Triggers by index of their dynamic slots
+     */
+    QVector< Trigger > Triggers;
+
+    /**
+     * Indexes of removed triggers that can be reused
+     */
+    QList< int > FreeSlots;
+
+    /**
+     * Installed triggers by object and event names
+     */
+    TriggerListMap TriggerList;
+
+    /**
+     * Persistent shell for triggers with shell="persistent", created when it is needed first time
+     */
+    ShellWorker *Shell;
+
+    /**
+     * Processes or groups of processes started by triggers that are not finished yet,
+     * they are deleted with their trigger, so output of stale commands does not update UI
+     *
+     * @key   - Index of trigger in Triggers
+     * @value - TriggerProcess or TriggerGroup, null when it is finished
+     */
+    QMultiHash< int, QPointer< QObject > > Running;
+
+    void handle( int id, const Trigger &trigger, const QStringList &arguments );
+    void removeTrigger( int id );
+    void stopProcesses( int id );
+
+public:
+    SignalDispatcher( WindowHandler *windowHandler );
+    ~SignalDispatcher() {}
+
+    void setTrigger( QObject *object, const QString &objectName, const QString &signalName, const Trigger &trigger );
+    void deleteTriggers();
+    void deleteTriggers( const QString &objectName );
+    void deleteTriggers( const QString &objectName, const QString &signalName );
+
+    int qt_metacall( QMetaObject::Call call, int id, void **arguments );
+};
+
+} // namespace OpenForm
+
+#endif // SIGNALDISPATCHER_H
@@ -0,0 +1,718 @@
+/**
+ * VaL::bOK <valbok@gmail.com>
+ * Created on: <10-Jun-2009 11:00:54 VaL>
+ *
+ * COPYRIGHT NOTICE: Copyright (C) 2009 VaL::bOK
+ * SOFTWARE LICENSE: GNU General Public License v2.0
+ */
+
+#include "spawnprocess.h"
+#include <QtCore/QFile>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <errno.h>
+#include <signal.h>
+#include <spawn.h>
+
+// Working directory can be set by posix_spawn() since glibc 2.29, vfork() is used otherwise
+#if defined( __GLIBC__ ) && ( __GLIBC__ > 2 || ( __GLIBC__ == 2 && __GLIBC_MINOR__ >= 29 ) )
+#define OPENFORM_SPAWN_CHDIR
+#endif
+
+extern char **environ;
+
+using namespace OpenForm;
+
+/**
+ * Size of data that is read from stdout at once
+ */
+static const int READ_SIZE = 16384;
+
+/**
+ * Interval in msecs to check if started stages are finished
+ */
+static const int EXIT_CHECK_INTERVAL = 10;
+
+/**
+ * Search path which is used when PATH is not set, the same as execvp() uses
+ */
+static const char DEFAULT_PATH[] = "/bin:/usr/bin";
+
+QByteArray ExecutableCache::SearchPath;
+QHash< QString, QString > ExecutableCache::Paths;
+
+/**
+ * Returns path of \a program found in \a searchPath ( value of PATH ), or empty string if it is not found.
+ * Relative and empty entries of \a searchPath are searched in \a workingDirectory ( current directory if it is empty ).
+ * Programs which contain '/' are returned as is.
+ */
+QString ExecutableCache::resolve( const QString &program, const QByteArray &searchPath, const QString &workingDirectory )
+{
+    // Relative paths are resolved in working directory of the command
+    if ( program.contains( '/' ) )
+    {
+        return program;
+    }
+
+    if ( searchPath != SearchPath )
+    {
+        Paths.clear();
+        SearchPath = searchPath;
+    }
+
+    QHash< QString, QString >::const_iterator it = Paths.find( program );
+    if ( it != Paths.end() )
+    {
+        return it.value();
+    }
+
+    // Relative and empty entries depend on working directory of each command,
+    // so programs found after them are not cached
+    bool cacheable = true;
+    const QList< QByteArray > dirs = ( searchPath.isEmpty() ? QByteArray( DEFAULT_PATH ) : searchPath ).split( ':' );
+    for ( int i = 0; i < dirs.size(); ++i )
+    {
+        QByteArray dir = dirs.at( i );
+        if ( !dir.startsWith( '/' ) )
+        {
+            cacheable = false;
+            const QByteArray base = workingDirectory.isEmpty() ? QByteArray( "." ) : QFile::encodeName( workingDirectory );
+            dir = dir.isEmpty() ? base : base + '/' + dir;
+        }
+
+        const QByteArray path = dir + '/' + QFile::encodeName( program );
+        struct stat info;
+        if ( ::stat( path.constData(), &info ) == 0 && S_ISREG( info.st_mode ) && ::access( path.constData(), X_OK ) == 0 )
+        {
+            const QString resolved = QFile::decodeName( path );
+            if ( cacheable )
+            {
+                Paths.insert( program, resolved );
+            }
+
+            return resolved;
+        }
+    }
+
+    return QString();
+}
+
+/**
+ * Removes cached path of \a program, it will be searched again
+ */
+void ExecutableCache::invalidate( const QString &program )
+{
+    Paths.remove( program );
+}
+
+/**
+ * Ignores SIGPIPE once, so writing to stdin of finished command does not kill the application
+ */
+static void ignoreSigpipe()
+{
+    static bool ignored = false;
+    if ( !ignored )
+    {
+        ::signal( SIGPIPE, SIG_IGN );
+        ignored = true;
+    }
+}
+
+/**
+ * Starts program by \a path with \a argv and environment \a envp, \a inputFd and \a outputFd become its stdin and stdout.
+ * \a errorFd becomes its stderr, stderr of the application is inherited if it is -1.
+ * Returns 0 and sets \a pid on success, or error code otherwise.
+ */
+static int spawnProgram( const char *path, char *const argv[], char *const envp[], const char *workingDirectory, int inputFd, int outputFd, int errorFd, pid_t *pid )
+{
+#ifdef OPENFORM_SPAWN_CHDIR
+    posix_spawn_file_actions_t actions;
+    posix_spawn_file_actions_init( &actions );
+    posix_spawn_file_actions_adddup2( &actions, inputFd, STDIN_FILENO );
+    posix_spawn_file_actions_adddup2( &actions, outputFd, STDOUT_FILENO );
+    if ( errorFd >= 0 )
+    {
+        posix_spawn_file_actions_adddup2( &actions, errorFd, STDERR_FILENO );
+    }
+
+    if ( workingDirectory )
+    {
+        posix_spawn_file_actions_addchdir_np( &actions, workingDirectory );
+    }
+
+    // Signals ignored or blocked by the application are restored for the command
+    posix_spawnattr_t attributes;
+    posix_spawnattr_init( &attributes );
+    sigset_t signals;
+    sigemptyset( &signals );
+    posix_spawnattr_setsigmask( &attributes, &signals );
+    sigaddset( &signals, SIGPIPE );
+    posix_spawnattr_setsigdefault( &attributes, &signals );
+    posix_spawnattr_setflags( &attributes, POSIX_SPAWN_SETSIGMASK | POSIX_SPAWN_SETSIGDEF );
+
+    int result = posix_spawn( pid, path, &actions, &attributes, argv, envp );
+
+    posix_spawnattr_destroy( &attributes );
+    posix_spawn_file_actions_destroy( &actions );
+
+    return result;
+#else
+    volatile int childError = 0;
+    pid_t child = vfork();
+    if ( child == 0 )
+    {
+        if ( ::dup2( inputFd, STDIN_FILENO ) != -1 && ::dup2( outputFd, STDOUT_FILENO ) != -1 &&
+             ( errorFd < 0 || ::dup2( errorFd, STDERR_FILENO ) != -1 ) &&
+             ( !workingDirectory || ::chdir( workingDirectory ) == 0 ) )
+        {
+            sigset_t signals;
+            sigemptyset( &signals );
+            ::sigprocmask( SIG_SETMASK, &signals, 0 );
+            ::signal( SIGPIPE, SIG_DFL );
+            ::execve( path, argv, envp );
+        }
+
+        // Child shares memory with the parent until exec, so the parent sees the error
+        childError = errno;
+        ::_exit( 127 );
+    }
+
+    if ( child < 0 )
+    {
+        return errno;
+    }
+
+    if ( childError )
+    {
+        ::waitpid( child, 0, 0 );
+        return childError;
+    }
+
+    *pid = child;
+
+    return 0;
+#endif
+}
+
+SpawnProcess::SpawnProcess( QObject *parent ):
+ QObject( parent ), Status( 0 ), InputFd( -1 ), InputNotifier( 0 ), CaptureError( false )
+{
+    this->ExitTimer.setInterval( EXIT_CHECK_INTERVAL );
+    connect( &this->ExitTimer, SIGNAL( timeout() ), this, SLOT( checkExit() ) );
+}
+
+SpawnProcess::~SpawnProcess()
+{
+    this->closeInput();
+    this->closeChannel( this->Output );
+    this->closeChannel( this->Error );
+
+    // Stages which are still running are killed like QProcess does
+    for ( int i = 0; i < this->Pids.size(); ++i )
+    {
+        if ( this->Pids.at( i ) )
+        {
+            ::kill( this->Pids.at( i ), SIGKILL );
+            ::waitpid( this->Pids.at( i ), 0, 0 );
+        }
+    }
+}
+
+/**
+ * Sets directory where commands are started
+ */
+void SpawnProcess::setWorkingDirectory( const QString &dir )
+{
+    this->WorkingDirectory = dir;
+}
+
+/**
+ * Sets environment of commands as "NAME=value" entries, empty \a environment means environment of the application
+ */
+void SpawnProcess::setEnvironment( const QStringList &environment )
+{
+    this->Environment.clear();
+    for ( int i = 0; i < environment.size(); ++i )
+    {
+        this->Environment.append( environment.at( i ).toLocal8Bit() );
+    }
+}
+
+/**
+ * Starts pipeline of \a stages, \a input is written to stdin of the first stage if provided.
+ * Stdin is empty otherwise.
+ */
+void SpawnProcess::start( const QStringList &stages, const QByteArray *input )
+{
+    int fds[2] = { -1, -1 };
+    int inputFd = -1;
+    if ( input )
+    {
+        if ( ::pipe2( fds, O_CLOEXEC ) == 0 )
+        {
+            inputFd = fds[0];
+            this->InputFd = fds[1];
+            this->Input = *input;
+        }
+    }
+    else
+    {
+        inputFd = ::open( "/dev/null", O_RDONLY | O_CLOEXEC );
+    }
+
+    if ( inputFd < 0 )
+    {
+        QTimer::singleShot( 0, this, SLOT( failToStart() ) );
+        return;
+    }
+
+    // All stages write errors to the same pipe
+    int errorFds[2] = { -1, -1 };
+    if ( this->CaptureError && ::pipe2( errorFds, O_CLOEXEC ) == 0 )
+    {
+        this->openChannel( this->Error, errorFds[0], SLOT( readFromStderr() ) );
+    }
+    else
+    {
+        // Stderr is inherited if the pipe could not be created
+        errorFds[0] = errorFds[1] = -1;
+    }
+
+    for ( int i = 0; i < stages.size(); ++i )
+    {
+        // Read end stays -1 if the pipe could not be created, so it is not closed
+        fds[0] = fds[1] = -1;
+
+        pid_t pid = -1;
+        if ( ::pipe2( fds, O_CLOEXEC ) == 0 )
+        {
+            pid = this->spawn( stages.at( i ), inputFd, fds[1], errorFds[1] );
+
+            // Descriptors are duplicated to the stage, only read end of its stdout is needed
+            ::close( fds[1] );
+        }
+
+        ::close( inputFd );
+        inputFd = fds[0];
+
+        if ( pid < 0 )
+        {
+            if ( inputFd >= 0 )
+            {
+                ::close( inputFd );
+            }
+
+            if ( errorFds[1] >= 0 )
+            {
+                ::close( errorFds[1] );
+            }
+
+            this->closeInput();
+            QTimer::singleShot( 0, this, SLOT( failToStart() ) );
+            return;
+        }
+
+        this->Pids.append( pid );
+    }
+
+    if ( errorFds[1] >= 0 )
+    {
+        ::close( errorFds[1] );
+    }
+
+    this->openChannel( this->Output, inputFd, SLOT( readFromStdout() ) );
+
+    if ( this->InputFd >= 0 )
+    {
+        ignoreSigpipe();
+        ::fcntl( this->InputFd, F_SETFL, O_NONBLOCK );
+        this->InputNotifier = new QSocketNotifier( this->InputFd, QSocketNotifier::Write, this );
+        connect( this->InputNotifier, SIGNAL( activated( int ) ), this, SLOT( writeToStdin() ) );
+    }
+
+    this->ExitTimer.start();
+}
+
+/**
+ * Returns data read from stdout since the last call
+ */
+QByteArray SpawnProcess::readAllStandardOutput()
+{
+    QByteArray result;
+    result.swap( this->Output.Data );
+
+    return result;
+}
+
+/**
+ * Returns data read from stderr since the last call
+ */
+QByteArray SpawnProcess::readAllStandardError()
+{
+    QByteArray result;
+    result.swap( this->Error.Data );
+
+    return result;
+}
+
+/**
+ * Splits \a command to program and arguments by the same rules as QProcess::start() does:
+ * arguments are separated by spaces, quoted by '"', and '"""' is a literal quote.
+ */
+QStringList SpawnProcess::splitCommand( const QString &command )
+{
+    QStringList args;
+    QString arg;
+    int quoteCount = 0;
+    bool inQuote = false;
+
+    for ( int i = 0; i < command.size(); ++i )
+    {
+        if ( command.at( i ) == '"' )
+        {
+            ++quoteCount;
+            if ( quoteCount == 3 )
+            {
+                // Third consecutive quote
+                quoteCount = 0;
+                arg += command.at( i );
+            }
+
+            continue;
+        }
+
+        if ( quoteCount )
+        {
+            if ( quoteCount == 1 )
+            {
+                inQuote = !inQuote;
+            }
+
+            quoteCount = 0;
+        }
+
+        if ( !inQuote && command.at( i ).isSpace() )
+        {
+            if ( !arg.isEmpty() )
+            {
+                args += arg;
+                arg.clear();
+            }
+        }
+        else
+        {
+            arg += command.at( i );
+        }
+    }
+
+    if ( !arg.isEmpty() )
+    {
+        args += arg;
+    }
+
+    return args;
+}
+
+/**
+ * Starts one stage of \a command, returns its pid or -1 if it could not be started
+ */
+pid_t SpawnProcess::spawn( const QString &command, int inputFd, int outputFd, int errorFd ) const
+{
+    const QStringList args = splitCommand( command );
+    if ( args.isEmpty() )
+    {
+        return -1;
+    }
+
+    QList< QByteArray > encodedArgs;
+    for ( int i = 0; i < args.size(); ++i )
+    {
+        encodedArgs.append( args.at( i ).toLocal8Bit() );
+    }
+
+    QVector< char* > argv;
+    for ( int i = 0; i < encodedArgs.size(); ++i )
+    {
+        argv.append( encodedArgs[i].data() );
+    }
+
+    argv.append( 0 );
+
+    const QByteArray workingDirectory = QFile::encodeName( this->WorkingDirectory );
+
+    // Programs are searched by PATH of the environment the command gets
+    QByteArray searchPath = qgetenv( "PATH" );
+    char *const *envp = environ;
+    QVector< char* > environment;
+    if ( !this->Environment.isEmpty() )
+    {
+        searchPath.clear();
+        for ( int i = 0; i < this->Environment.size(); ++i )
+        {
+            const QByteArray &entry = this->Environment.at( i );
+            if ( entry.startsWith( "PATH=" ) )
+            {
+                searchPath = entry.mid( 5 );
+            }
+
+            environment.append( const_cast< char* >( entry.constData() ) );
+        }
+
+        environment.append( 0 );
+        envp = environment.data();
+    }
+
+    // Cached path is outdated when the program is removed, it is searched again once
+    for ( int attempt = 0; attempt < 2; ++attempt )
+    {
+        const QByteArray path = QFile::encodeName( ExecutableCache::resolve( args.first(), searchPath, this->WorkingDirectory ) );
+        if ( path.isEmpty() )
+        {
+            return -1;
+        }
+
+        pid_t pid = -1;
+        int result = spawnProgram( path.constData(), argv.data(), envp, workingDirectory.isEmpty() ? 0 : workingDirectory.constData(), inputFd, outputFd, errorFd, &pid );
+
+        // Executable file without a recognized header like a script without "#!" is run by /bin/sh as execvp() does
+        if ( result == ENOEXEC )
+        {
+            QVector< char* > shellArgv;
+            shellArgv.append( const_cast< char* >( "sh" ) );
+            shellArgv.append( const_cast< char* >( path.constData() ) );
+            for ( int i = 1; i < argv.size(); ++i )
+            {
+                shellArgv.append( argv.at( i ) );
+            }
+
+            result = spawnProgram( "/bin/sh", shellArgv.data(), envp, workingDirectory.isEmpty() ? 0 : workingDirectory.constData(), inputFd, outputFd, errorFd, &pid );
+        }
+
+        if ( result == 0 )
+        {
+            return pid;
+        }
+
+        if ( result != ENOENT && result != EACCES )
+        {
+            break;
+        }
+
+        ExecutableCache::invalidate( args.first() );
+    }
+
+    return -1;
+}
+
+void SpawnProcess::closeInput()
+{
+    this->Input.clear();
+    if ( this->InputNotifier )
+    {
+        this->InputNotifier->setEnabled( false );
+        this->InputNotifier->deleteLater();
+        this->InputNotifier = 0;
+    }
+
+    if ( this->InputFd >= 0 )
+    {
+        ::close( this->InputFd );
+        this->InputFd = -1;
+    }
+}
+
+/**
+ * Reads \a channel from \a fd without blocking, \a member is called when data is ready to be read
+ */
+void SpawnProcess::openChannel( Channel &channel, int fd, const char *member )
+{
+    channel.Fd = fd;
+    ::fcntl( channel.Fd, F_SETFL, O_NONBLOCK );
+    channel.Notifier = new QSocketNotifier( channel.Fd, QSocketNotifier::Read, this );
+    connect( channel.Notifier, SIGNAL( activated( int ) ), this, member );
+}
+
+void SpawnProcess::closeChannel( Channel &channel )
+{
+    if ( channel.Notifier )
+    {
+        channel.Notifier->setEnabled( false );
+        channel.Notifier->deleteLater();
+        channel.Notifier = 0;
+    }
+
+    if ( channel.Fd >= 0 )
+    {
+        ::close( channel.Fd );
+        channel.Fd = -1;
+    }
+}
+
+/**
+ * Reads available data from \a channel without blocking, returns false if nothing is read
+ */
+bool SpawnProcess::readChannel( Channel &channel )
+{
+    if ( channel.Fd < 0 )
+    {
+        return false;
+    }
+
+    char data[READ_SIZE];
+    ssize_t size = ::read( channel.Fd, data, READ_SIZE );
+    if ( size < 0 && ( errno == EAGAIN || errno == EINTR ) )
+    {
+        return false;
+    }
+
+    // All stages closed the pipe or it is failed
+    if ( size <= 0 )
+    {
+        this->closeChannel( channel );
+        return false;
+    }
+
+    channel.Data.append( data, size );
+
+    return true;
+}
+
+/**
+ * Writes pending input to stdin of the first stage, it is closed when everything is written
+ */
+void SpawnProcess::writeToStdin()
+{
+    while ( !this->Input.isEmpty() )
+    {
+        ssize_t size = ::write( this->InputFd, this->Input.constData(), this->Input.size() );
+        if ( size < 0 && errno == EINTR )
+        {
+            continue;
+        }
+
+        if ( size < 0 && errno == EAGAIN )
+        {
+            return;
+        }
+
+        // The command does not read stdin anymore
+        if ( size < 0 )
+        {
+            break;
+        }
+
+        this->Input.remove( 0, size );
+    }
+
+    this->closeInput();
+}
+
+/**
+ * Reads data from stdout when data is ready to be read
+ */
+void SpawnProcess::readFromStdout()
+{
+    if ( this->readChannel( this->Output ) )
+    {
+        emit this->readyReadStandardOutput();
+    }
+    else if ( this->Output.Fd < 0 )
+    {
+        // Stdout is closed, the command is probably finished
+        this->checkExit();
+    }
+}
+
+/**
+ * Reads data from stderr when data is ready to be read
+ */
+void SpawnProcess::readFromStderr()
+{
+    if ( this->readChannel( this->Error ) )
+    {
+        emit this->readyReadStandardError();
+    }
+}
+
+/**
+ * Emits finished() when all stages are finished
+ */
+void SpawnProcess::checkExit()
+{
+    bool running = false;
+    for ( int i = 0; i < this->Pids.size(); ++i )
+    {
+        if ( !this->Pids.at( i ) )
+        {
+            continue;
+        }
+
+        int status = 0;
+        pid_t result = ::waitpid( this->Pids.at( i ), &status, WNOHANG );
+        if ( result == 0 || ( result < 0 && errno == EINTR ) )
+        {
+            running = true;
+            continue;
+        }
+
+        if ( result > 0 && i == this->Pids.size() - 1 )
+        {
+            this->Status = status;
+        }
+
+        this->Pids[i] = 0;
+    }
+
+    if ( running || !this->ExitTimer.isActive() )
+    {
+        return;
+    }
+
+    this->ExitTimer.stop();
+
+    // Data written before exit may be still in the pipes
+    bool received = false;
+    while ( this->readChannel( this->Output ) )
+    {
+        received = true;
+    }
+
+    bool receivedError = false;
+    while ( this->readChannel( this->Error ) )
+    {
+        receivedError = true;
+    }
+
+    this->closeInput();
+    this->closeChannel( this->Output );
+    this->closeChannel( this->Error );
+
+    if ( receivedError )
+    {
+        emit this->readyReadStandardError();
+    }
+
+    if ( received )
+    {
+        emit this->readyReadStandardOutput();
+    }
+
+    if ( WIFSIGNALED( this->Status ) )
+    {
+        emit this->finished( WTERMSIG( this->Status ), QProcess::CrashExit );
+    }
+    else
+    {
+        emit this->finished( WEXITSTATUS( this->Status ), QProcess::NormalExit );
+    }
+}
+
+/**
+ * Reports that the command could not be started
+ */
+void SpawnProcess::failToStart()
+{
+    emit this->error( QProcess::FailedToStart );
+}
@@ -0,0 +1,184 @@
+/**
+ * VaL::bOK <valbok@gmail.com>
+ * Created on: <10-Jun-2009 11:00:54 VaL>
+ *
+ * COPYRIGHT NOTICE: Copyright (C) 2009 VaL::bOK
+ * SOFTWARE LICENSE: GNU General Public License v2.0
+ */
+
+#ifndef SPAWNPROCESS_H
+#define SPAWNPROCESS_H
+
+#include <QtCore/QObject>
+#include <QtCore/QByteArray>
+#include <QtCore/QHash>
+#include <QtCore/QStringList>
+#include <QtCore/QTimer>
+#include <QtCore/QVector>
+#include <QtCore/QSocketNotifier>
+#include <QProcess>
+#include <sys/types.h>
+
+namespace OpenForm
+{
+
+/**
+ * This class resolves program names to absolute paths by PATH like execvp() does.
+ * Resolved paths are cached, the cache is dropped when the search path is changed.
+ * Paths found by relative or empty entries of the search path are not cached.
+ */
+class ExecutableCache
+{
+    /**
+     * Value of PATH which cached paths are resolved by
+     */
+    static QByteArray SearchPath;
+
+    /**
+     * Map of program name to its resolved path
+     */
+    static QHash< QString, QString > Paths;
+
+public:
+    static QString resolve( const QString &program, const QByteArray &searchPath, const QString &workingDirectory );
+    static void invalidate( const QString &program );
+};
+
+/**
+ * This class starts commands by posix_spawn() (or vfork() where the working directory
+ * can not be set by posix_spawn()), so address space of the application is not copied for each command.
+ *
+ * Each command is a pipeline of stages, stdout of each stage is connected to stdin of the next one.
+ * Signals are compatible with QProcess, only stdout of the last stage is read.
+ * Stderr of stages is inherited from the application unless it is captured.
+ */
+class SpawnProcess: public QObject
+{
+    Q_OBJECT
+
+    /**
+     * Directory where commands are started
+     */
+    QString WorkingDirectory;
+
+    /**
+     * Environment of commands as "NAME=value" entries, environment of the application if empty
+     */
+    QList< QByteArray > Environment;
+
+    /**
+     * Started stages, 0 when the stage is finished
+     */
+    QVector< pid_t > Pids;
+
+    /**
+     * Exit status of the last stage as it is returned by waitpid()
+     */
+    int Status;
+
+    /**
+     * Write end of stdin of the first stage, -1 if closed
+     */
+    int InputFd;
+
+    /**
+     * Data which is not written to stdin yet
+     */
+    QByteArray Input;
+
+    QSocketNotifier *InputNotifier;
+
+    /**
+     * Pipe where output of stages is read from
+     */
+    struct Channel
+    {
+        /**
+         * Read end of the pipe, -1 if closed
+         */
+        int Fd;
+
+        QSocketNotifier *Notifier;
+
+        /**
+         * Data which is read but not fetched yet
+         */
+        QByteArray Data;
+
+        Channel(): Fd( -1 ), Notifier( 0 ), Data() {}
+    };
+
+    /**
+     * Stdout of the last stage
+     */
+    Channel Output;
+
+    /**
+     * Stderr of all stages if it is captured
+     */
+    Channel Error;
+
+    /**
+     * If stderr of stages is read instead of being inherited from the application
+     */
+    bool CaptureError;
+
+    /**
+     * Checks if started stages are finished
+     */
+    QTimer ExitTimer;
+
+    pid_t spawn( const QString &command, int inputFd, int outputFd, int errorFd ) const;
+    void closeInput();
+    void openChannel( Channel &channel, int fd, const char *member );
+    void closeChannel( Channel &channel );
+    bool readChannel( Channel &channel );
+
+private slots:
+
+    void writeToStdin();
+    void readFromStdout();
+    void readFromStderr();
+    void checkExit();
+    void failToStart();
+
+public:
+    SpawnProcess( QObject *parent = 0 );
+    ~SpawnProcess();
+
+    void setWorkingDirectory( const QString &dir );
+    void setEnvironment( const QStringList &environment );
+    void setCaptureStandardError( bool capture ) { this->CaptureError = capture; }
+    void start( const QStringList &stages, const QByteArray *input = 0 );
+    QByteArray readAllStandardOutput();
+    QByteArray readAllStandardError();
+
+    static QStringList splitCommand( const QString &command );
+
+signals:
+
+    /**
+     * Emits when new data is read from stdout of the last stage
+     */
+    void readyReadStandardOutput();
+
+    /**
+     * Emits when new data is read from stderr of stages if it is captured
+     */
+    void readyReadStandardError();
+
+    /**
+     * Emits when all stages are finished, \a exitCode and \a exitStatus are taken from the last one
+     */
+    void finished( int exitCode, QProcess::ExitStatus exitStatus );
+
+    /**
+     * Emits when a stage could not be started
+     */
+    void error( QProcess::ProcessError error );
+
+};
+
+} // namespace OpenForm
+
+#endif // SPAWNPROCESS_H
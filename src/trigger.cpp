@@ -7,126 +7,274 @@
  */
 
 #include "trigger.h"
-#include "commandhandler.h"
+#include "shellworker.h"
 
 using namespace OpenForm;
 
-Trigger::Trigger( const QString &command, const QString &action, const QObject *object, const WindowHandler *windowHandler, const QString &sig ):
- Command( command ), WinHandler( windowHandler )
+Trigger::Trigger( const QStringList &commands, const QString &action, const QString &objectName, const QString &sig ):
+ Commands( commands ), ApplyAll( false ), PersistentShell( false ), HasInput( false ), InputFormat( WidgetSnapshot::KeyValue ), SignalIndex( -1 )
 {
-    if ( !object )
+    this->setAction( action, objectName, sig );
+}
+
+void Trigger::setAction( const QString &action, const QString &objectName, const QString &sig )
+{
+    this->Action = ( action == Actions::EXECUTE || action == Actions::RETURN || action == Actions::CALL ) ? action : ( action.isEmpty() ? Actions::EXECUTE : QString() );
+    if ( this->Action.isEmpty() )
     {
-        return;
+        fprintf( stderr, "%s::%s: Unsupported action '%s'\n", objectName.toLocal8Bit().constData(), sig.toLocal8Bit().constData(), action.toLocal8Bit().constData() );
+        this->Action = Actions::EXECUTE;
     }
+}
 
-    this->setAction( action, object->objectName(), sig );
+/**
+ * Sets \a format of widget values that are written to stdin of executed command.
+ * \a widgets is comma separated list of widget names, all named widgets are used if it is empty.
+ */
+void Trigger::setInput( const QString &format, const QString &widgets )
+{
+    this->HasInput = WidgetSnapshot::formatByName( format, &this->InputFormat );
+    if ( !this->HasInput )
+    {
+        fprintf( stderr, "Unsupported input format '%s'\n", format.toLocal8Bit().constData() );
+        return;
+    }
 
-    // Handle provided signal
-    QByteArray sigMacro = sig.toUtf8();
-    sigMacro.prepend( "2" );
-    QObject::connect( object, sigMacro, this, SLOT( handle() ) );
+    this->InputWidgets = widgets.split( ",", QString::SkipEmptyParts );
+    for ( int i = 0; i < this->InputWidgets.size(); ++i )
+    {
+        this->InputWidgets[i] = this->InputWidgets[i].trimmed();
+    }
+}
 
-    // Update UI by new one
-    QObject::connect( this, SIGNAL( uiChanged( const QString & ) ), this->WinHandler, SLOT( setUiFrom( const QString & ) ) );
+/**
+ * Sets how UI updates of several commands are applied: \a apply is "each" or "all"
+ */
+void Trigger::setApply( const QString &apply )
+{
+    this->ApplyAll = apply == Apply::ALL;
+    if ( !this->ApplyAll && apply != Apply::EACH )
+    {
+        fprintf( stderr, "Unsupported apply '%s'\n", apply.toLocal8Bit().constData() );
+    }
+}
 
-    // When data should be returned to user
-    if ( this->Action == Actions::RETURN )
+/**
+ * Sets where commands are executed: \a shell is "none" or "persistent"
+ */
+void Trigger::setShell( const QString &shell )
+{
+    this->PersistentShell = shell == Shells::PERSISTENT;
+    if ( !this->PersistentShell && shell != Shells::NONE )
     {
-        QObject::connect( this, SIGNAL( dataReturned( const QString & ) ), this->WinHandler, SLOT( returnData( const QString & ) ) );
+        fprintf( stderr, "Unsupported shell '%s'\n", shell.toLocal8Bit().constData() );
     }
 }
 
-void Trigger::setAction( const QString &action, const QString &objectName, const QString &sig )
+/**
+ * Adds pipeline of \a stages, output of each stage is passed to the next one without a shell
+ */
+void Trigger::addPipeline( const QStringList &stages )
 {
-    this->Action = ( action == Actions::EXECUTE || action == Actions::RETURN ) ? action : ( action.isEmpty() ? Actions::EXECUTE : QString() );
-    if ( this->Action.isEmpty() )
+    if ( this->Action != Actions::EXECUTE )
     {
-        fprintf( stderr, "%s::%s: Unsupported action '%s'\n", objectName.toLocal8Bit().constData(), sig.toLocal8Bit().constData(), action.toLocal8Bit().constData() );
-        this->Action = Actions::EXECUTE;
+        fprintf( stderr, "Pipelines are supported by action '%s' only\n", Actions::EXECUTE.toLocal8Bit().constData() );
+        return;
+    }
+
+    if ( !stages.isEmpty() )
+    {
+        this->Pipelines.append( stages );
     }
 }
 
-bool Trigger::handle()
+/**
+ * Adds \a process which returned data should be collected, the process is owned by this group
+ */
+void TriggerGroup::addProcess( TriggerProcess *process )
 {
-    if ( this->Command.isEmpty() || !this->WinHandler )
+    process->setParent( this );
+    this->Indexes.insert( process, this->Results.size() );
+    this->Results.append( QString() );
+
+    connect( process, SIGNAL( uiChanged( const QString & ) ), this, SLOT( setResult( const QString & ) ) );
+    connect( process, SIGNAL( destroyed( QObject* ) ), this, SLOT( processDestroyed( QObject* ) ) );
+}
+
+/**
+ * Stores returned \a data of finished process
+ */
+void TriggerGroup::setResult( const QString &data )
+{
+    this->Results[this->Indexes.value( this->sender() )] = data;
+}
+
+/**
+ * Emits returned data when the last process is finished
+ */
+void TriggerGroup::processDestroyed( QObject *process )
+{
+    this->Indexes.remove( process );
+    if ( !this->Indexes.isEmpty() )
     {
-        return false;
+        return;
     }
 
-    CommandHandler parser;
+    for ( int i = 0; i < this->Results.size(); ++i )
+    {
+        if ( !this->Results.at( i ).isEmpty() )
+        {
+            emit this->uiChanged( this->Results.at( i ) );
+        }
+    }
 
-    this->ParsedCommand = parser.parse( this->WinHandler->getWidget(), this->Command );
+    this->deleteLater();
+}
 
-    // Check if it needs to execute the command
-    if ( this->Action == Actions::EXECUTE )
+TriggerProcess::TriggerProcess( const QStringList &stages, const QString &workingDirectory, QObject *parent, ShellWorker *shell ):
+ QObject( parent ), Stages( stages ), ParsedCommand( stages.join( " | " ) ), Shell( shell )
+{
+    // Persistent shell executes the command itself
+    if ( this->Shell )
     {
-        // Previous returned data should be cleared
-        this->ReturnedData = QString();
+        return;
+    }
 
-        this->Process.setReadChannelMode( QProcess::SeparateChannels );
-        this->Process.setReadChannel( QProcess::StandardOutput );
+    // Commands are relative to the directory where UI is loaded from
+    this->Process.setWorkingDirectory( workingDirectory );
 
-        // Read data when it is ready
-        connect( &this->Process, SIGNAL( readyReadStandardOutput() ), this, SLOT( readFromStdout() ) );
-        // When reading is finished return data to update UI
-        connect( &this->Process, SIGNAL( finished( int, QProcess::ExitStatus ) ), this, SLOT( finished( int, QProcess::ExitStatus ) ) );
-        // Handle errors
-        connect( &this->Process, SIGNAL( error( QProcess::ProcessError ) ), this, SLOT( error( QProcess::ProcessError ) ) );
+    // Read data when it is ready
+    connect( &this->Process, SIGNAL( readyReadStandardOutput() ), this, SLOT( readFromStdout() ) );
+    // When reading is finished return data to update UI
+    connect( &this->Process, SIGNAL( finished( int, QProcess::ExitStatus ) ), this, SLOT( finished( int, QProcess::ExitStatus ) ) );
+    // Handle errors
+    connect( &this->Process, SIGNAL( error( QProcess::ProcessError ) ), this, SLOT( error( QProcess::ProcessError ) ) );
+}
 
-        this->Process.start( this->ParsedCommand );
+TriggerProcess::~TriggerProcess()
+{
+    // Killed process must not update UI
+    this->disconnectHandlers();
+
+    // Command is dropped from the queue or killed with the shell
+    if ( this->Shell )
+    {
+        this->Shell->cancel( this );
     }
-    else if ( this->Action == Actions::RETURN ) // or just return parsed command to user
+}
+
+/**
+ * Errors of the command and its stderr are written to \a output instead of stderr of the application
+ */
+void TriggerProcess::setErrorOutput( QIODevice *output )
+{
+    this->ErrorOutput = output;
+    if ( output && !this->Shell )
     {
-        emit this->dataReturned( this->ParsedCommand );
+        this->Process.setCaptureStandardError( true );
+        connect( &this->Process, SIGNAL( readyReadStandardError() ), this, SLOT( readFromStderr() ) );
     }
+}
 
-    return true;
+/**
+ * Sets environment of the command, environment of the application is used if \a environment is empty
+ */
+void TriggerProcess::setEnvironment( const QStringList &environment )
+{
+    // Persistent shell has environment of the form
+    if ( !this->Shell )
+    {
+        this->Process.setEnvironment( environment );
+    }
+}
+
+/**
+ * Starts the command, \a input is written to its stdin if provided
+ */
+void TriggerProcess::start( const QByteArray *input )
+{
+    // Shell runs pipelines itself
+    if ( this->Shell )
+    {
+        this->Shell->execute( this, this->ParsedCommand, input );
+        return;
+    }
+
+    // Stages are connected directly without a shell, input is written to the first one
+    this->Process.start( this->Stages, input );
+}
+
+/**
+ * Finishes the command executed in persistent shell with \a exitCode and returned \a data
+ */
+void TriggerProcess::finishInShell( int exitCode, const QByteArray &data, bool crashed )
+{
+    this->ReturnedData = data.constData();
+    this->finished( exitCode, crashed ? QProcess::CrashExit : QProcess::NormalExit );
 }
 
 /**
  * Reads data from stdout when data is ready to be read
  */
-void Trigger::readFromStdout()
+void TriggerProcess::readFromStdout()
 {
-    QProcess *process = (QProcess*) this->sender();
-    QByteArray result = process->readAllStandardOutput();
+    QByteArray result = this->Process.readAllStandardOutput();
 
     this->ReturnedData += result.data();
 }
 
+/**
+ * Passes stderr of the command to the error output
+ */
+void TriggerProcess::readFromStderr()
+{
+    const QByteArray data = this->Process.readAllStandardError();
+    if ( this->ErrorOutput )
+    {
+        this->ErrorOutput->write( data );
+    }
+}
+
 /**
  * Update UI by returned data
  */
-void Trigger::finished( int exitCode, QProcess::ExitStatus exitStatus )
+void TriggerProcess::finished( int exitCode, QProcess::ExitStatus exitStatus )
 {
-    Trigger::disconnectHandlers();
+    this->disconnectHandlers();
+    this->deleteLater();
+
     if ( exitStatus == QProcess::CrashExit )
     {
-        fprintf( stderr, "Process has been crashed: '%s'\n", this->ParsedCommand.toLocal8Bit().constData() );
+        this->printError( QString( "Process has been crashed: '%1'\n" ).arg( this->ParsedCommand ) );
         return;
     }
 
     if ( exitCode != 0 )
     {
-        fprintf( stderr, "Could not execute (exitcode: %i): '%s'\n", exitCode, this->ParsedCommand.toLocal8Bit().constData() );
+        this->printError( QString( "Could not execute (exitcode: %1): '%2'\n" ).arg( exitCode ).arg( this->ParsedCommand ) );
         return;
     }
 
     if ( this->ReturnedData.isEmpty() )
     {
-        fprintf( stderr, "No data returned: '%s'\n", this->ParsedCommand.toLocal8Bit().constData() );
+        this->printError( QString( "No data returned: '%1'\n" ).arg( this->ParsedCommand ) );
         return;
     }
 
     emit this->uiChanged( this->ReturnedData );
-
 }
 
 /**
  * Handles errors
  */
-void Trigger::error( QProcess::ProcessError error )
+void TriggerProcess::error( QProcess::ProcessError error )
 {
+    // A command that does not read stdin still returns valid output, stdin is just closed
+    if ( error == QProcess::WriteError )
+    {
+        return;
+    }
+
     QString errorStr;
     switch ( error )
     {
@@ -145,11 +293,6 @@ void Trigger::error( QProcess::ProcessError error )
             errorStr = "Timeout";
         } break;
 
-        case QProcess::WriteError:
-        {
-            errorStr = "Write error";
-        } break;
-
         case QProcess::ReadError:
         {
             errorStr = "Read error";
@@ -162,12 +305,13 @@ void Trigger::error( QProcess::ProcessError error )
         } break;
     }
 
-    Trigger::disconnectHandlers();
+    this->disconnectHandlers();
+    this->deleteLater();
 
-    fprintf( stderr, "Could not execute (%s): '%s'\n", errorStr.toLocal8Bit().constData(), this->ParsedCommand.toLocal8Bit().constData() );
+    this->printError( QString( "Could not execute (%1): '%2'\n" ).arg( errorStr, this->ParsedCommand ) );
 }
 
-void Trigger::disconnectHandlers() const
+void TriggerProcess::disconnectHandlers() const
 {
     // Read data when it is ready
     disconnect( &this->Process, SIGNAL( readyReadStandardOutput() ), this, SLOT( readFromStdout() ) );
@@ -176,3 +320,18 @@ void Trigger::disconnectHandlers() const
     // Handle errors
     disconnect( &this->Process, SIGNAL( error( QProcess::ProcessError ) ), this, SLOT( error( QProcess::ProcessError ) ) );
 }
+
+/**
+ * Prints \a message to the error output or to stderr
+ */
+void TriggerProcess::printError( const QString &message ) const
+{
+    if ( this->ErrorOutput )
+    {
+        this->ErrorOutput->write( message.toLocal8Bit() );
+    }
+    else
+    {
+        fprintf( stderr, "%s", message.toLocal8Bit().constData() );
+    }
+}
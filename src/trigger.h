@@ -9,14 +9,21 @@
 #ifndef TRIGGERHANDLER_H
 #define TRIGGERHANDLER_H
 
+#include <QtCore/QHash>
 #include <QtCore/QObject>
+#include <QtCore/QPointer>
+#include <QtCore/QStringList>
 #include <QProcess>
 
-#include "windowhandler.h"
+#include "spawnprocess.h"
+#include "widgetsnapshot.h"
 
 namespace OpenForm
 {
 
+class TriggerProcess;
+class ShellWorker;
+
 /**
  * List of supported actions
  */
@@ -32,31 +39,68 @@ namespace Actions
      */
     const QString RETURN = "return";
 
+    /**
+     * When this action is used needs to call native handler registered by name with values of input commands
+     *
+     * @sa CallHandler
+     */
+    const QString CALL = "call";
+
 }; // namespace Actions
 
 /**
- * This class contains methods to handle events e.g. to execute a command when someone clicks on button
+ * List of supported ways to apply UI updates of several commands
  */
-class Trigger: public QObject
+namespace Apply
 {
-    Q_OBJECT
+    /**
+     * Each update is applied as soon as its command is finished
+     */
+    const QString EACH = "each";
+
+    /**
+     * Updates are applied in order of commands when all of them are finished
+     */
+    const QString ALL = "all";
 
-private:
+}; // namespace Apply
 
+/**
+ * List of supported shells to execute commands
+ */
+namespace Shells
+{
     /**
-     * Command that should be executed
+     * Each command is started as new process
      */
-    const QString Command;
+    const QString NONE = "none";
 
     /**
-     * Parsed command
+     * Commands are written to one long-lived shell of the form, they are interpreted by the shell
      */
-    QString ParsedCommand;
+    const QString PERSISTENT = "persistent";
+
+}; // namespace Shells
+
+/**
+ * This class contains settings of one event e.g. to execute a command when someone clicks on button.
+ *
+ * It is a plain record, signals are received by SignalDispatcher of window handler
+ * and processes are created only while commands are executed.
+ */
+class Trigger
+{
+    friend class SignalDispatcher;
 
     /**
-     * Window handler where UI is stored
+     * Commands that should be executed, they are run in parallel if there are several
      */
-    const WindowHandler *WinHandler;
+    QStringList Commands;
+
+    /**
+     * Pipelines that should be executed in parallel with Commands, each one is a list of stage commands
+     */
+    QList< QStringList > Pipelines;
 
     /**
      * Current action
@@ -66,28 +110,156 @@ private:
     QString Action;
 
     /**
-     * Result data of Command executing
+     * Whether UI updates of several commands are applied together when all of them are finished
+     *
+     * @sa namespace Apply
      */
-    QString ReturnedData;
+    bool ApplyAll;
+
+    /**
+     * Whether commands are executed in persistent shell of the form
+     *
+     * @sa namespace Shells
+     */
+    bool PersistentShell;
+
+    /**
+     * Whether widget values should be written to stdin of executed command
+     */
+    bool HasInput;
+
+    /**
+     * Format of widget values written to stdin
+     */
+    WidgetSnapshot::Format InputFormat;
+
+    /**
+     * Names of widgets which values are written to stdin, all named widgets if empty
+     */
+    QStringList InputWidgets;
+
+    /**
+     * Object which signal is handled
+     */
+    QPointer< QObject > Sender;
+
+    /**
+     * Index of handled signal of Sender, -1 if the trigger is not installed
+     */
+    int SignalIndex;
+
+    /**
+     * Meta types of signal arguments
+     */
+    QList< int > ArgumentTypes;
 
-    QProcess Process;
     void setAction( const QString &action, const QString &objectName, const QString &sig );
+
+public:
+    Trigger(): ApplyAll( false ), PersistentShell( false ), HasInput( false ), InputFormat( WidgetSnapshot::KeyValue ), SignalIndex( -1 ) {}
+    Trigger( const QStringList &commands, const QString &action, const QString &objectName, const QString &sig );
+
+    QStringList getCommands() const { return this->Commands; }
+    bool isNull() const { return this->SignalIndex < 0; }
+    void setInput( const QString &format, const QString &widgets );
+    void setApply( const QString &apply );
+    void addPipeline( const QStringList &stages );
+    void setShell( const QString &shell );
+};
+
+/**
+ * This class collects UI updates of several commands executed in parallel
+ * and emits them in order of commands when all of them are finished
+ */
+class TriggerGroup: public QObject
+{
+    Q_OBJECT
+
+    /**
+     * Returned data by command index, empty if command has failed
+     */
+    QStringList Results;
+
+    /**
+     * Command index by its process
+     */
+    QHash< QObject*, int > Indexes;
+
+private slots:
+
+    void setResult( const QString &data );
+    void processDestroyed( QObject *process );
+
+public:
+    TriggerGroup( QObject *parent ): QObject( parent ) {}
+    ~TriggerGroup() {}
+
+    void addProcess( TriggerProcess *process );
+
+signals:
+
+    /**
+     * Emits when UI should be updated by \a data
+     */
+    void uiChanged( const QString &data );
+
+};
+
+/**
+ * This class executes one command or pipeline of a trigger, fetches returned data and deletes itself when it is finished
+ */
+class TriggerProcess: public QObject
+{
+    Q_OBJECT
+
+    /**
+     * Parsed commands of pipeline stages, one if it is not a pipeline
+     */
+    const QStringList Stages;
+
+    /**
+     * Parsed command, stages are separated by '|'
+     */
+    const QString ParsedCommand;
+
+    /**
+     * Result data of ParsedCommand executing
+     */
+    QString ReturnedData;
+
+    /**
+     * Spawned stages, output of the last one is returned
+     */
+    SpawnProcess Process;
+
+    /**
+     * Persistent shell where the command is executed instead of Process, 0 if not used
+     */
+    QPointer< ShellWorker > Shell;
+
+    /**
+     * Device where errors of the command are written, stderr if 0
+     */
+    QPointer< QIODevice > ErrorOutput;
+
     void disconnectHandlers() const;
+    void printError( const QString &message ) const;
 
 private slots:
 
     void readFromStdout();
+    void readFromStderr();
     void finished( int exitCode, QProcess::ExitStatus exitStatus );
     void error( QProcess::ProcessError error );
 
 public:
-    Trigger( const QString &command, const QString &action, const QObject *object, const WindowHandler *windowHandler, const QString &sig );
-    ~Trigger() {}
-
-    QString getCommand() const { return this->Command; }
+    TriggerProcess( const QStringList &stages, const QString &workingDirectory, QObject *parent, ShellWorker *shell = 0 );
+    ~TriggerProcess();
 
-public slots:
-    bool handle();
+    void setErrorOutput( QIODevice *output );
+    void setEnvironment( const QStringList &environment );
+    void start( const QByteArray *input = 0 );
+    void finishInShell( int exitCode, const QByteArray &data, bool crashed = false );
 
 signals:
 
@@ -96,11 +268,6 @@ signals:
      */
     void uiChanged( const QString &data );
 
-    /**
-     * Emits when just needs to return \a data to user
-     */
-    void dataReturned( const QString &data );
-
 };
 
 } // namespace OpenForm
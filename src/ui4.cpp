@@ -40,6 +40,11 @@
 ****************************************************************************/
 #include "ui4_p.h"
 
+// BEGIN: Val
+#include <QtCore/QHash>
+#include <QtCore/QThreadStorage>
+// END: Val
+
 #ifdef QUILOADER_QDOM_READ
 #include <QtXml/QDomElement>
 #endif
@@ -49,6 +54,58 @@ QT_BEGIN_NAMESPACE
 using namespace QFormInternal;
 #endif
 
+// BEGIN: Val
+/**
+ * Returns case insensitive hash of element name without allocating lowered copy of it.
+ * Case labels of stream readers are precomputed by the same function ( h = h * 33 + c )
+ * and are unique within each reader, matched tag is still verified by compare().
+ */
+static inline uint tagHash( const QStringRef &tag )
+{
+    uint result = 0;
+    const QChar *c = tag.unicode();
+    for ( int i = 0; i < tag.size(); ++i )
+    {
+        ushort u = c[i].unicode();
+        if ( u >= 'A' && u <= 'Z' )
+            u += 'a' - 'A';
+
+        result = result * 33 + u;
+    }
+
+    return result;
+}
+
+/**
+ * Maximum amount of strings kept by internString() per thread.
+ */
+static const int INTERN_LIMIT = 4096;
+
+/**
+ * Returns shared copy of frequently repeated attribute value ( property names, class names ).
+ * Interned strings are kept per thread so forms can be parsed in parallel,
+ * repeated value is returned as implicitly shared QString without new allocation.
+ */
+static QString internString( const QStringRef &value )
+{
+    static QThreadStorage<QHash<uint, QString>*> tables;
+    if ( !tables.hasLocalData() )
+        tables.setLocalData( new QHash<uint, QString>() );
+
+    QHash<uint, QString> *table = tables.localData();
+    const uint key = tagHash( value ) ^ value.size();
+    QHash<uint, QString>::const_iterator it = table->constFind( key );
+    if ( it != table->constEnd() && value == it.value() )
+        return it.value();
+
+    QString result = value.toString();
+    if ( it == table->constEnd() && table->size() < INTERN_LIMIT )
+        table->insert( key, result );
+
+    return result;
+}
+// END: Val
+
 /*******************************************************************************
 ** Implementations
 */
@@ -66,6 +123,7 @@ void DomUI::clear(bool clear_all)
     delete m_connections;
     // BEGIN: Val
     delete m_triggers;
+    qDeleteAll( m_select );
     // END: Val
     delete m_designerdata;
     delete m_slots;
@@ -94,6 +152,7 @@ void DomUI::clear(bool clear_all)
     m_connections = 0;
     // BEGIN: Val
     m_triggers = 0;
+    m_select.clear();
     // END: Val
     m_designerdata = 0;
     m_slots = 0;
@@ -140,6 +199,7 @@ DomUI::~DomUI()
     delete m_connections;
     // BEGIN: Val
     delete m_triggers;
+    qDeleteAll( m_select );
     // END: Val
     delete m_designerdata;
     delete m_slots;
@@ -155,124 +215,175 @@ void DomUI::readUpdated( QXmlStreamReader &reader )
         {
             case QXmlStreamReader::StartElement :
             {
-                const QString tag = reader.name().toString().toLower();
-                if ( tag == QLatin1String( "author" ) )
-                {
-                    setElementAuthor( reader.readElementText() );
-                    continue;
-                }
-                if ( tag == QLatin1String( "comment" ) )
-                {
-                    setElementComment( reader.readElementText() );
-                    continue;
-                }
-                if ( tag == QLatin1String( "exportmacro" ) )
-                {
-                    setElementExportMacro( reader.readElementText() );
-                    continue;
-                }
-                if ( tag == QLatin1String( "class" ) )
-                {
-                    setElementClass( reader.readElementText() );
-                    continue;
-                }
-                if ( tag == QLatin1String( "widget" ) )
-                {
-                    DomWidget *v = new DomWidget();
-                    v->read( reader );
-                    setElementWidget( v );
-                    continue;
-                }
-                if ( tag == QLatin1String( "layoutdefault" ) )
-                {
-                    DomLayoutDefault *v = new DomLayoutDefault();
-                    v->read(reader);
-                    setElementLayoutDefault( v );
-                    continue;
-                }
-                if ( tag == QLatin1String( "layoutfunction" ) )
-                {
-                    DomLayoutFunction *v = new DomLayoutFunction();
-                    v->read( reader );
-                    setElementLayoutFunction( v );
-                    continue;
-                }
-                if ( tag == QLatin1String( "pixmapfunction" ) )
-                {
-                    setElementPixmapFunction( reader.readElementText() );
-                    continue;
-                }
-                if ( tag == QLatin1String( "customwidgets" ) )
-                {
-                    DomCustomWidgets *v = new DomCustomWidgets();
-                    v->read( reader );
-                    setElementCustomWidgets( v );
-                    continue;
-                }
-                if ( tag == QLatin1String( "tabstops" ) )
-                {
-                    DomTabStops *v = new DomTabStops();
-                    v->read( reader );
-                    setElementTabStops( v );
-                    continue;
-                }
-                if ( tag == QLatin1String( "images" ) )
-                {
-                    DomImages *v = new DomImages();
-                    v->read( reader );
-                    setElementImages( v );
-                    continue;
-                }
-                if ( tag == QLatin1String( "includes" ) )
-                {
-                    DomIncludes *v = new DomIncludes();
-                    v->read( reader );
-                    setElementIncludes( v );
-                    continue;
-                }
-                if ( tag == QLatin1String( "resources" ) )
-                {
-                    DomResources *v = new DomResources();
-                    v->read( reader );
-                    setElementResources( v );
-                    continue;
-                }
-                if ( tag == QLatin1String( "connections" ) )
-                {
-                    DomConnections *v = new DomConnections();
-                    v->read( reader );
-                    setElementConnections( v );
-                    continue;
-                }
-                if ( tag == QLatin1String( "triggers" ) )
-                {
-                    DomTriggers *v = new DomTriggers();
-                    v->read( reader );
-                    setElementTriggers( v );
-                    continue;
-                }
-                if ( tag == QLatin1String( "designerdata" ) )
-                {
-                    DomDesignerData *v = new DomDesignerData();
-                    v->read( reader );
-                    setElementDesignerdata( v );
-                    continue;
-                }
-                if ( tag == QLatin1String( "slots" ) )
-                {
-                    DomSlots *v = new DomSlots();
-                    v->read( reader );
-                    setElementSlots( v );
-                    continue;
-                }
-                if ( tag == QLatin1String( "buttongroups" ) )
+                const QStringRef tag = reader.name();
+                switch ( tagHash( tag ) )
                 {
-                    DomButtonGroups *v = new DomButtonGroups();
-                    v->read( reader );
-                    setElementButtonGroups( v );
-                    continue;
+                    case 0xeacafd13u : // author
+                        if ( tag.compare( QLatin1String( "author" ), Qt::CaseInsensitive ) == 0 )
+                        {
+                            setElementAuthor( reader.readElementText() );
+                            continue;
+                        }
+                        break;
+                    case 0xcfa40cf3u : // comment
+                        if ( tag.compare( QLatin1String( "comment" ), Qt::CaseInsensitive ) == 0 )
+                        {
+                            setElementComment( reader.readElementText() );
+                            continue;
+                        }
+                        break;
+                    case 0x477512f4u : // exportmacro
+                        if ( tag.compare( QLatin1String( "exportmacro" ), Qt::CaseInsensitive ) == 0 )
+                        {
+                            setElementExportMacro( reader.readElementText() );
+                            continue;
+                        }
+                        break;
+                    case 0x073c5eb6u : // class
+                        if ( tag.compare( QLatin1String( "class" ), Qt::CaseInsensitive ) == 0 )
+                        {
+                            setElementClass( reader.readElementText() );
+                            continue;
+                        }
+                        break;
+                    case 0x1d3a8944u : // widget
+                        if ( tag.compare( QLatin1String( "widget" ), Qt::CaseInsensitive ) == 0 )
+                        {
+                            DomWidget *v = new DomWidget();
+                            v->read( reader );
+                            setElementWidget( v );
+                            continue;
+                        }
+                        break;
+                    case 0x212ecfc3u : // layoutdefault
+                        if ( tag.compare( QLatin1String( "layoutdefault" ), Qt::CaseInsensitive ) == 0 )
+                        {
+                            DomLayoutDefault *v = new DomLayoutDefault();
+                            v->read(reader);
+                            setElementLayoutDefault( v );
+                            continue;
+                        }
+                        break;
+                    case 0x01fd1aa4u : // layoutfunction
+                        if ( tag.compare( QLatin1String( "layoutfunction" ), Qt::CaseInsensitive ) == 0 )
+                        {
+                            DomLayoutFunction *v = new DomLayoutFunction();
+                            v->read( reader );
+                            setElementLayoutFunction( v );
+                            continue;
+                        }
+                        break;
+                    case 0x0b846ab5u : // pixmapfunction
+                        if ( tag.compare( QLatin1String( "pixmapfunction" ), Qt::CaseInsensitive ) == 0 )
+                        {
+                            setElementPixmapFunction( reader.readElementText() );
+                            continue;
+                        }
+                        break;
+                    case 0xacf1ded2u : // customwidgets
+                        if ( tag.compare( QLatin1String( "customwidgets" ), Qt::CaseInsensitive ) == 0 )
+                        {
+                            DomCustomWidgets *v = new DomCustomWidgets();
+                            v->read( reader );
+                            setElementCustomWidgets( v );
+                            continue;
+                        }
+                        break;
+                    case 0x25a18db0u : // tabstops
+                        if ( tag.compare( QLatin1String( "tabstops" ), Qt::CaseInsensitive ) == 0 )
+                        {
+                            DomTabStops *v = new DomTabStops();
+                            v->read( reader );
+                            setElementTabStops( v );
+                            continue;
+                        }
+                        break;
+                    case 0xfcd90d56u : // images
+                        if ( tag.compare( QLatin1String( "images" ), Qt::CaseInsensitive ) == 0 )
+                        {
+                            DomImages *v = new DomImages();
+                            v->read( reader );
+                            setElementImages( v );
+                            continue;
+                        }
+                        break;
+                    case 0xe9595717u : // includes
+                        if ( tag.compare( QLatin1String( "includes" ), Qt::CaseInsensitive ) == 0 )
+                        {
+                            DomIncludes *v = new DomIncludes();
+                            v->read( reader );
+                            setElementIncludes( v );
+                            continue;
+                        }
+                        break;
+                    case 0xb53ea07bu : // resources
+                        if ( tag.compare( QLatin1String( "resources" ), Qt::CaseInsensitive ) == 0 )
+                        {
+                            DomResources *v = new DomResources();
+                            v->read( reader );
+                            setElementResources( v );
+                            continue;
+                        }
+                        break;
+                    case 0x33485003u : // connections
+                        if ( tag.compare( QLatin1String( "connections" ), Qt::CaseInsensitive ) == 0 )
+                        {
+                            DomConnections *v = new DomConnections();
+                            v->read( reader );
+                            setElementConnections( v );
+                            continue;
+                        }
+                        break;
+                    case 0x51b341a7u : // triggers
+                        if ( tag.compare( QLatin1String( "triggers" ), Qt::CaseInsensitive ) == 0 )
+                        {
+                            DomTriggers *v = new DomTriggers();
+                            v->read( reader );
+                            setElementTriggers( v );
+                            continue;
+                        }
+                        break;
+                    case 0x13a1df00u : // select
+                        if ( tag.compare( QLatin1String( "select" ), Qt::CaseInsensitive ) == 0 )
+                        {
+                            DomSelect *v = new DomSelect();
+                            v->read( reader );
+                            m_select.append( v );
+                            m_children |= Select;
+                            continue;
+                        }
+                        break;
+                    case 0x6a50bc0bu : // designerdata
+                        // Designer data is not used to create widgets, so it is not parsed
+                        if ( tag.compare( QLatin1String( "designerdata" ), Qt::CaseInsensitive ) == 0 )
+                        {
+                            reader.skipCurrentElement();
+                            continue;
+                        }
+                        break;
+                    case 0x085e2275u : // slots
+                        if ( tag.compare( QLatin1String( "slots" ), Qt::CaseInsensitive ) == 0 )
+                        {
+                            DomSlots *v = new DomSlots();
+                            v->read( reader );
+                            setElementSlots( v );
+                            continue;
+                        }
+                        break;
+                    case 0xca58169cu : // buttongroups
+                        if ( tag.compare( QLatin1String( "buttongroups" ), Qt::CaseInsensitive ) == 0 )
+                        {
+                            DomButtonGroups *v = new DomButtonGroups();
+                            v->read( reader );
+                            setElementButtonGroups( v );
+                            continue;
+                        }
+                        break;
+                    default :
+                        break;
                 }
-                reader.raiseError( QLatin1String( "readUpdated: Unexpected element " ) + tag );
+
+                reader.raiseError( QLatin1String( "readUpdated: Unexpected element " ) + tag.toString() );
             } break;
 
         case QXmlStreamReader::EndElement :
@@ -393,6 +504,14 @@ void DomUI::readUpdated( const QDomElement &node )
             setElementTriggers( v );
             continue;
         }
+        if ( tag == QLatin1String( "select" ) )
+        {
+            DomSelect *v = new DomSelect();
+            v->read( e );
+            m_select.append( v );
+            m_children |= Select;
+            continue;
+        }
         if ( tag == QLatin1String( "designerdata" ) )
         {
             DomDesignerData *v = new DomDesignerData();
@@ -457,108 +576,147 @@ void DomUI::read(QXmlStreamReader &reader)
     for (bool finished = false; !finished && !reader.hasError();) {
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
-            const QString tag = reader.name().toString().toLower();
-            if (tag == QLatin1String("author")) {
-                setElementAuthor(reader.readElementText());
-                continue;
-            }
-            if (tag == QLatin1String("comment")) {
-                setElementComment(reader.readElementText());
-                continue;
-            }
-            if (tag == QLatin1String("exportmacro")) {
-                setElementExportMacro(reader.readElementText());
-                continue;
-            }
-            if (tag == QLatin1String("class")) {
-                setElementClass(reader.readElementText());
-                continue;
-            }
-            if (tag == QLatin1String("widget")) {
-                DomWidget *v = new DomWidget();
-                v->read(reader);
-                setElementWidget(v);
-                continue;
-            }
-            if (tag == QLatin1String("layoutdefault")) {
-                DomLayoutDefault *v = new DomLayoutDefault();
-                v->read(reader);
-                setElementLayoutDefault(v);
-                continue;
-            }
-            if (tag == QLatin1String("layoutfunction")) {
-                DomLayoutFunction *v = new DomLayoutFunction();
-                v->read(reader);
-                setElementLayoutFunction(v);
-                continue;
-            }
-            if (tag == QLatin1String("pixmapfunction")) {
-                setElementPixmapFunction(reader.readElementText());
-                continue;
-            }
-            if (tag == QLatin1String("customwidgets")) {
-                DomCustomWidgets *v = new DomCustomWidgets();
-                v->read(reader);
-                setElementCustomWidgets(v);
-                continue;
-            }
-            if (tag == QLatin1String("tabstops")) {
-                DomTabStops *v = new DomTabStops();
-                v->read(reader);
-                setElementTabStops(v);
-                continue;
-            }
-            if (tag == QLatin1String("images")) {
-                DomImages *v = new DomImages();
-                v->read(reader);
-                setElementImages(v);
-                continue;
-            }
-            if (tag == QLatin1String("includes")) {
-                DomIncludes *v = new DomIncludes();
-                v->read(reader);
-                setElementIncludes(v);
-                continue;
-            }
-            if (tag == QLatin1String("resources")) {
-                DomResources *v = new DomResources();
-                v->read(reader);
-                setElementResources(v);
-                continue;
-            }
-            if (tag == QLatin1String("connections")) {
-                DomConnections *v = new DomConnections();
-                v->read(reader);
-                setElementConnections(v);
-                continue;
-            }
+            const QStringRef tag = reader.name();
+            switch (tagHash(tag)) {
+            case 0xeacafd13u: // author
+                if (tag.compare(QLatin1String("author"), Qt::CaseInsensitive) == 0) {
+                    setElementAuthor(reader.readElementText());
+                    continue;
+                }
+                break;
+            case 0xcfa40cf3u: // comment
+                if (tag.compare(QLatin1String("comment"), Qt::CaseInsensitive) == 0) {
+                    setElementComment(reader.readElementText());
+                    continue;
+                }
+                break;
+            case 0x477512f4u: // exportmacro
+                if (tag.compare(QLatin1String("exportmacro"), Qt::CaseInsensitive) == 0) {
+                    setElementExportMacro(reader.readElementText());
+                    continue;
+                }
+                break;
+            case 0x073c5eb6u: // class
+                if (tag.compare(QLatin1String("class"), Qt::CaseInsensitive) == 0) {
+                    setElementClass(reader.readElementText());
+                    continue;
+                }
+                break;
+            case 0x1d3a8944u: // widget
+                if (tag.compare(QLatin1String("widget"), Qt::CaseInsensitive) == 0) {
+                    DomWidget *v = new DomWidget();
+                    v->read(reader);
+                    setElementWidget(v);
+                    continue;
+                }
+                break;
+            case 0x212ecfc3u: // layoutdefault
+                if (tag.compare(QLatin1String("layoutdefault"), Qt::CaseInsensitive) == 0) {
+                    DomLayoutDefault *v = new DomLayoutDefault();
+                    v->read(reader);
+                    setElementLayoutDefault(v);
+                    continue;
+                }
+                break;
+            case 0x01fd1aa4u: // layoutfunction
+                if (tag.compare(QLatin1String("layoutfunction"), Qt::CaseInsensitive) == 0) {
+                    DomLayoutFunction *v = new DomLayoutFunction();
+                    v->read(reader);
+                    setElementLayoutFunction(v);
+                    continue;
+                }
+                break;
+            case 0x0b846ab5u: // pixmapfunction
+                if (tag.compare(QLatin1String("pixmapfunction"), Qt::CaseInsensitive) == 0) {
+                    setElementPixmapFunction(reader.readElementText());
+                    continue;
+                }
+                break;
+            case 0xacf1ded2u: // customwidgets
+                if (tag.compare(QLatin1String("customwidgets"), Qt::CaseInsensitive) == 0) {
+                    DomCustomWidgets *v = new DomCustomWidgets();
+                    v->read(reader);
+                    setElementCustomWidgets(v);
+                    continue;
+                }
+                break;
+            case 0x25a18db0u: // tabstops
+                if (tag.compare(QLatin1String("tabstops"), Qt::CaseInsensitive) == 0) {
+                    DomTabStops *v = new DomTabStops();
+                    v->read(reader);
+                    setElementTabStops(v);
+                    continue;
+                }
+                break;
+            case 0xfcd90d56u: // images
+                if (tag.compare(QLatin1String("images"), Qt::CaseInsensitive) == 0) {
+                    DomImages *v = new DomImages();
+                    v->read(reader);
+                    setElementImages(v);
+                    continue;
+                }
+                break;
+            case 0xe9595717u: // includes
+                if (tag.compare(QLatin1String("includes"), Qt::CaseInsensitive) == 0) {
+                    DomIncludes *v = new DomIncludes();
+                    v->read(reader);
+                    setElementIncludes(v);
+                    continue;
+                }
+                break;
+            case 0xb53ea07bu: // resources
+                if (tag.compare(QLatin1String("resources"), Qt::CaseInsensitive) == 0) {
+                    DomResources *v = new DomResources();
+                    v->read(reader);
+                    setElementResources(v);
+                    continue;
+                }
+                break;
+            case 0x33485003u: // connections
+                if (tag.compare(QLatin1String("connections"), Qt::CaseInsensitive) == 0) {
+                    DomConnections *v = new DomConnections();
+                    v->read(reader);
+                    setElementConnections(v);
+                    continue;
+                }
+                break;
             // BEGIN: Val
-            if (tag == QLatin1String("triggers")) {
-                DomTriggers *v = new DomTriggers();
-                v->read(reader);
-                setElementTriggers(v);
-                continue;
-            }
+            case 0x51b341a7u: // triggers
+                if (tag.compare(QLatin1String("triggers"), Qt::CaseInsensitive) == 0) {
+                    DomTriggers *v = new DomTriggers();
+                    v->read(reader);
+                    setElementTriggers(v);
+                    continue;
+                }
+                break;
             // END: Val
-            if (tag == QLatin1String("designerdata")) {
-                DomDesignerData *v = new DomDesignerData();
-                v->read(reader);
-                setElementDesignerdata(v);
-                continue;
-            }
-            if (tag == QLatin1String("slots")) {
-                DomSlots *v = new DomSlots();
-                v->read(reader);
-                setElementSlots(v);
-                continue;
-            }
-            if (tag == QLatin1String("buttongroups")) {
-                DomButtonGroups *v = new DomButtonGroups();
-                v->read(reader);
-                setElementButtonGroups(v);
-                continue;
+            case 0x6a50bc0bu: // designerdata
+                // Designer data is not used to create widgets, so it is not parsed
+                if (tag.compare(QLatin1String("designerdata"), Qt::CaseInsensitive) == 0) {
+                    reader.skipCurrentElement();
+                    continue;
+                }
+                break;
+            case 0x085e2275u: // slots
+                if (tag.compare(QLatin1String("slots"), Qt::CaseInsensitive) == 0) {
+                    DomSlots *v = new DomSlots();
+                    v->read(reader);
+                    setElementSlots(v);
+                    continue;
+                }
+                break;
+            case 0xca58169cu: // buttongroups
+                if (tag.compare(QLatin1String("buttongroups"), Qt::CaseInsensitive) == 0) {
+                    DomButtonGroups *v = new DomButtonGroups();
+                    v->read(reader);
+                    setElementButtonGroups(v);
+                    continue;
+                }
+                break;
+            default:
+                break;
             }
-            reader.raiseError(QLatin1String("Unexpected element ") + tag);
+            reader.raiseError(QLatin1String("Unexpected element ") + tag.toString());
         }
             break;
         case QXmlStreamReader::EndElement :
@@ -782,6 +940,11 @@ void DomUI::write(QXmlStreamWriter &writer, const QString &tagName) const
     {
         m_triggers->write( writer, QLatin1String( "triggers" ) );
     }
+
+    for ( int i = 0; i < m_select.size(); ++i )
+    {
+        m_select[i]->write( writer, QLatin1String( "select" ) );
+    }
     // END: Val
 
     if (m_children & Designerdata) {
@@ -1124,6 +1287,19 @@ void DomUI::clearElementTriggers()
     m_triggers = 0;
     m_children &= ~Triggers;
 }
+
+void DomUI::setElementSelect( const QList< DomSelect* > &a )
+{
+    m_children |= Select;
+    m_select = a;
+}
+
+void DomUI::clearElementSelect()
+{
+    qDeleteAll( m_select );
+    m_select.clear();
+    m_children &= ~Select;
+}
 // END: Val
 
 void DomUI::clearElementDesignerdata()
@@ -1176,14 +1352,20 @@ void DomIncludes::read(QXmlStreamReader &reader)
     for (bool finished = false; !finished && !reader.hasError();) {
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
-            const QString tag = reader.name().toString().toLower();
-            if (tag == QLatin1String("include")) {
-                DomInclude *v = new DomInclude();
-                v->read(reader);
-                m_include.append(v);
-                continue;
+            const QStringRef tag = reader.name();
+            switch (tagHash(tag)) {
+            case 0x9a771224u: // include
+                if (tag.compare(QLatin1String("include"), Qt::CaseInsensitive) == 0) {
+                    DomInclude *v = new DomInclude();
+                    v->read(reader);
+                    m_include.append(v);
+                    continue;
+                }
+                break;
+            default:
+                break;
             }
-            reader.raiseError(QLatin1String("Unexpected element ") + tag);
+            reader.raiseError(QLatin1String("Unexpected element ") + tag.toString());
         }
             break;
         case QXmlStreamReader::EndElement :
@@ -1285,8 +1467,8 @@ void DomInclude::read(QXmlStreamReader &reader)
     for (bool finished = false; !finished && !reader.hasError();) {
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
-            const QString tag = reader.name().toString().toLower();
-            reader.raiseError(QLatin1String("Unexpected element ") + tag);
+            const QStringRef tag = reader.name();
+            reader.raiseError(QLatin1String("Unexpected element ") + tag.toString());
         }
             break;
         case QXmlStreamReader::EndElement :
@@ -1380,14 +1562,20 @@ void DomResources::read(QXmlStreamReader &reader)
     for (bool finished = false; !finished && !reader.hasError();) {
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
-            const QString tag = reader.name().toString().toLower();
-            if (tag == QLatin1String("include")) {
-                DomResource *v = new DomResource();
-                v->read(reader);
-                m_include.append(v);
-                continue;
+            const QStringRef tag = reader.name();
+            switch (tagHash(tag)) {
+            case 0x9a771224u: // include
+                if (tag.compare(QLatin1String("include"), Qt::CaseInsensitive) == 0) {
+                    DomResource *v = new DomResource();
+                    v->read(reader);
+                    m_include.append(v);
+                    continue;
+                }
+                break;
+            default:
+                break;
             }
-            reader.raiseError(QLatin1String("Unexpected element ") + tag);
+            reader.raiseError(QLatin1String("Unexpected element ") + tag.toString());
         }
             break;
         case QXmlStreamReader::EndElement :
@@ -1488,8 +1676,8 @@ void DomResource::read(QXmlStreamReader &reader)
     for (bool finished = false; !finished && !reader.hasError();) {
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
-            const QString tag = reader.name().toString().toLower();
-            reader.raiseError(QLatin1String("Unexpected element ") + tag);
+            const QStringRef tag = reader.name();
+            reader.raiseError(QLatin1String("Unexpected element ") + tag.toString());
         }
             break;
         case QXmlStreamReader::EndElement :
@@ -1590,32 +1778,44 @@ void DomActionGroup::read(QXmlStreamReader &reader)
     for (bool finished = false; !finished && !reader.hasError();) {
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
-            const QString tag = reader.name().toString().toLower();
-            if (tag == QLatin1String("action")) {
-                DomAction *v = new DomAction();
-                v->read(reader);
-                m_action.append(v);
-                continue;
-            }
-            if (tag == QLatin1String("actiongroup")) {
-                DomActionGroup *v = new DomActionGroup();
-                v->read(reader);
-                m_actionGroup.append(v);
-                continue;
-            }
-            if (tag == QLatin1String("property")) {
-                DomProperty *v = new DomProperty();
-                v->read(reader);
-                m_property.append(v);
-                continue;
-            }
-            if (tag == QLatin1String("attribute")) {
-                DomProperty *v = new DomProperty();
-                v->read(reader);
-                m_attribute.append(v);
-                continue;
+            const QStringRef tag = reader.name();
+            switch (tagHash(tag)) {
+            case 0xe985483eu: // action
+                if (tag.compare(QLatin1String("action"), Qt::CaseInsensitive) == 0) {
+                    DomAction *v = new DomAction();
+                    v->read(reader);
+                    m_action.append(v);
+                    continue;
+                }
+                break;
+            case 0x303a65cbu: // actiongroup
+                if (tag.compare(QLatin1String("actiongroup"), Qt::CaseInsensitive) == 0) {
+                    DomActionGroup *v = new DomActionGroup();
+                    v->read(reader);
+                    m_actionGroup.append(v);
+                    continue;
+                }
+                break;
+            case 0xaf4cdd45u: // property
+                if (tag.compare(QLatin1String("property"), Qt::CaseInsensitive) == 0) {
+                    DomProperty *v = new DomProperty();
+                    v->read(reader);
+                    m_property.append(v);
+                    continue;
+                }
+                break;
+            case 0x23eeb194u: // attribute
+                if (tag.compare(QLatin1String("attribute"), Qt::CaseInsensitive) == 0) {
+                    DomProperty *v = new DomProperty();
+                    v->read(reader);
+                    m_attribute.append(v);
+                    continue;
+                }
+                break;
+            default:
+                break;
             }
-            reader.raiseError(QLatin1String("Unexpected element ") + tag);
+            reader.raiseError(QLatin1String("Unexpected element ") + tag.toString());
         }
             break;
         case QXmlStreamReader::EndElement :
@@ -1778,20 +1978,28 @@ void DomAction::read(QXmlStreamReader &reader)
     for (bool finished = false; !finished && !reader.hasError();) {
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
-            const QString tag = reader.name().toString().toLower();
-            if (tag == QLatin1String("property")) {
-                DomProperty *v = new DomProperty();
-                v->read(reader);
-                m_property.append(v);
-                continue;
-            }
-            if (tag == QLatin1String("attribute")) {
-                DomProperty *v = new DomProperty();
-                v->read(reader);
-                m_attribute.append(v);
-                continue;
+            const QStringRef tag = reader.name();
+            switch (tagHash(tag)) {
+            case 0xaf4cdd45u: // property
+                if (tag.compare(QLatin1String("property"), Qt::CaseInsensitive) == 0) {
+                    DomProperty *v = new DomProperty();
+                    v->read(reader);
+                    m_property.append(v);
+                    continue;
+                }
+                break;
+            case 0x23eeb194u: // attribute
+                if (tag.compare(QLatin1String("attribute"), Qt::CaseInsensitive) == 0) {
+                    DomProperty *v = new DomProperty();
+                    v->read(reader);
+                    m_attribute.append(v);
+                    continue;
+                }
+                break;
+            default:
+                break;
             }
-            reader.raiseError(QLatin1String("Unexpected element ") + tag);
+            reader.raiseError(QLatin1String("Unexpected element ") + tag.toString());
         }
             break;
         case QXmlStreamReader::EndElement :
@@ -1913,8 +2121,8 @@ void DomActionRef::read(QXmlStreamReader &reader)
     for (bool finished = false; !finished && !reader.hasError();) {
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
-            const QString tag = reader.name().toString().toLower();
-            reader.raiseError(QLatin1String("Unexpected element ") + tag);
+            const QStringRef tag = reader.name();
+            reader.raiseError(QLatin1String("Unexpected element ") + tag.toString());
         }
             break;
         case QXmlStreamReader::EndElement :
@@ -2007,20 +2215,28 @@ void DomButtonGroup::read(QXmlStreamReader &reader)
     for (bool finished = false; !finished && !reader.hasError();) {
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
-            const QString tag = reader.name().toString().toLower();
-            if (tag == QLatin1String("property")) {
-                DomProperty *v = new DomProperty();
-                v->read(reader);
-                m_property.append(v);
-                continue;
-            }
-            if (tag == QLatin1String("attribute")) {
-                DomProperty *v = new DomProperty();
-                v->read(reader);
-                m_attribute.append(v);
-                continue;
+            const QStringRef tag = reader.name();
+            switch (tagHash(tag)) {
+            case 0xaf4cdd45u: // property
+                if (tag.compare(QLatin1String("property"), Qt::CaseInsensitive) == 0) {
+                    DomProperty *v = new DomProperty();
+                    v->read(reader);
+                    m_property.append(v);
+                    continue;
+                }
+                break;
+            case 0x23eeb194u: // attribute
+                if (tag.compare(QLatin1String("attribute"), Qt::CaseInsensitive) == 0) {
+                    DomProperty *v = new DomProperty();
+                    v->read(reader);
+                    m_attribute.append(v);
+                    continue;
+                }
+                break;
+            default:
+                break;
             }
-            reader.raiseError(QLatin1String("Unexpected element ") + tag);
+            reader.raiseError(QLatin1String("Unexpected element ") + tag.toString());
         }
             break;
         case QXmlStreamReader::EndElement :
@@ -2130,14 +2346,20 @@ void DomButtonGroups::read(QXmlStreamReader &reader)
     for (bool finished = false; !finished && !reader.hasError();) {
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
-            const QString tag = reader.name().toString().toLower();
-            if (tag == QLatin1String("buttongroup")) {
-                DomButtonGroup *v = new DomButtonGroup();
-                v->read(reader);
-                m_buttonGroup.append(v);
-                continue;
+            const QStringRef tag = reader.name();
+            switch (tagHash(tag)) {
+            case 0x25297509u: // buttongroup
+                if (tag.compare(QLatin1String("buttongroup"), Qt::CaseInsensitive) == 0) {
+                    DomButtonGroup *v = new DomButtonGroup();
+                    v->read(reader);
+                    m_buttonGroup.append(v);
+                    continue;
+                }
+                break;
+            default:
+                break;
             }
-            reader.raiseError(QLatin1String("Unexpected element ") + tag);
+            reader.raiseError(QLatin1String("Unexpected element ") + tag.toString());
         }
             break;
         case QXmlStreamReader::EndElement :
@@ -2225,14 +2447,20 @@ void DomImages::read(QXmlStreamReader &reader)
     for (bool finished = false; !finished && !reader.hasError();) {
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
-            const QString tag = reader.name().toString().toLower();
-            if (tag == QLatin1String("image")) {
-                DomImage *v = new DomImage();
-                v->read(reader);
-                m_image.append(v);
-                continue;
+            const QStringRef tag = reader.name();
+            switch (tagHash(tag)) {
+            case 0x07a97c83u: // image
+                if (tag.compare(QLatin1String("image"), Qt::CaseInsensitive) == 0) {
+                    DomImage *v = new DomImage();
+                    v->read(reader);
+                    m_image.append(v);
+                    continue;
+                }
+                break;
+            default:
+                break;
             }
-            reader.raiseError(QLatin1String("Unexpected element ") + tag);
+            reader.raiseError(QLatin1String("Unexpected element ") + tag.toString());
         }
             break;
         case QXmlStreamReader::EndElement :
@@ -2331,14 +2559,20 @@ void DomImage::read(QXmlStreamReader &reader)
     for (bool finished = false; !finished && !reader.hasError();) {
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
-            const QString tag = reader.name().toString().toLower();
-            if (tag == QLatin1String("data")) {
-                DomImageData *v = new DomImageData();
-                v->read(reader);
-                setElementData(v);
-                continue;
+            const QStringRef tag = reader.name();
+            switch (tagHash(tag)) {
+            case 0x003881dau: // data
+                if (tag.compare(QLatin1String("data"), Qt::CaseInsensitive) == 0) {
+                    DomImageData *v = new DomImageData();
+                    v->read(reader);
+                    setElementData(v);
+                    continue;
+                }
+                break;
+            default:
+                break;
             }
-            reader.raiseError(QLatin1String("Unexpected element ") + tag);
+            reader.raiseError(QLatin1String("Unexpected element ") + tag.toString());
         }
             break;
         case QXmlStreamReader::EndElement :
@@ -2464,8 +2698,8 @@ void DomImageData::read(QXmlStreamReader &reader)
     for (bool finished = false; !finished && !reader.hasError();) {
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
-            const QString tag = reader.name().toString().toLower();
-            reader.raiseError(QLatin1String("Unexpected element ") + tag);
+            const QStringRef tag = reader.name();
+            reader.raiseError(QLatin1String("Unexpected element ") + tag.toString());
         }
             break;
         case QXmlStreamReader::EndElement :
@@ -2548,14 +2782,20 @@ void DomCustomWidgets::read(QXmlStreamReader &reader)
     for (bool finished = false; !finished && !reader.hasError();) {
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
-            const QString tag = reader.name().toString().toLower();
-            if (tag == QLatin1String("customwidget")) {
-                DomCustomWidget *v = new DomCustomWidget();
-                v->read(reader);
-                m_customWidget.append(v);
-                continue;
+            const QStringRef tag = reader.name();
+            switch (tagHash(tag)) {
+            case 0xcef00e7fu: // customwidget
+                if (tag.compare(QLatin1String("customwidget"), Qt::CaseInsensitive) == 0) {
+                    DomCustomWidget *v = new DomCustomWidget();
+                    v->read(reader);
+                    m_customWidget.append(v);
+                    continue;
+                }
+                break;
+            default:
+                break;
             }
-            reader.raiseError(QLatin1String("Unexpected element ") + tag);
+            reader.raiseError(QLatin1String("Unexpected element ") + tag.toString());
         }
             break;
         case QXmlStreamReader::EndElement :
@@ -2651,8 +2891,8 @@ void DomHeader::read(QXmlStreamReader &reader)
     for (bool finished = false; !finished && !reader.hasError();) {
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
-            const QString tag = reader.name().toString().toLower();
-            reader.raiseError(QLatin1String("Unexpected element ") + tag);
+            const QStringRef tag = reader.name();
+            reader.raiseError(QLatin1String("Unexpected element ") + tag.toString());
         }
             break;
         case QXmlStreamReader::EndElement :
@@ -2752,64 +2992,90 @@ void DomCustomWidget::read(QXmlStreamReader &reader)
     for (bool finished = false; !finished && !reader.hasError();) {
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
-            const QString tag = reader.name().toString().toLower();
-            if (tag == QLatin1String("class")) {
-                setElementClass(reader.readElementText());
-                continue;
-            }
-            if (tag == QLatin1String("extends")) {
-                setElementExtends(reader.readElementText());
-                continue;
-            }
-            if (tag == QLatin1String("header")) {
-                DomHeader *v = new DomHeader();
-                v->read(reader);
-                setElementHeader(v);
-                continue;
-            }
-            if (tag == QLatin1String("sizehint")) {
-                DomSize *v = new DomSize();
-                v->read(reader);
-                setElementSizeHint(v);
-                continue;
-            }
-            if (tag == QLatin1String("addpagemethod")) {
-                setElementAddPageMethod(reader.readElementText());
-                continue;
-            }
-            if (tag == QLatin1String("container")) {
-                setElementContainer(reader.readElementText().toInt());
-                continue;
-            }
-            if (tag == QLatin1String("sizepolicy")) {
-                DomSizePolicyData *v = new DomSizePolicyData();
-                v->read(reader);
-                setElementSizePolicy(v);
-                continue;
-            }
-            if (tag == QLatin1String("pixmap")) {
-                setElementPixmap(reader.readElementText());
-                continue;
-            }
-            if (tag == QLatin1String("script")) {
-                DomScript *v = new DomScript();
-                v->read(reader);
-                setElementScript(v);
-                continue;
-            }
-            if (tag == QLatin1String("properties")) {
-                DomProperties *v = new DomProperties();
-                v->read(reader);
-                setElementProperties(v);
-                continue;
-            }
-            if (tag == QLatin1String("slots")) {
-                DomSlots *v = new DomSlots();
-                v->read(reader);
-                setElementSlots(v);
-                continue;
+            const QStringRef tag = reader.name();
+            switch (tagHash(tag)) {
+            case 0x073c5eb6u: // class
+                if (tag.compare(QLatin1String("class"), Qt::CaseInsensitive) == 0) {
+                    setElementClass(reader.readElementText());
+                    continue;
+                }
+                break;
+            case 0x7f11619bu: // extends
+                if (tag.compare(QLatin1String("extends"), Qt::CaseInsensitive) == 0) {
+                    setElementExtends(reader.readElementText());
+                    continue;
+                }
+                break;
+            case 0xf9f313e9u: // header
+                if (tag.compare(QLatin1String("header"), Qt::CaseInsensitive) == 0) {
+                    DomHeader *v = new DomHeader();
+                    v->read(reader);
+                    setElementHeader(v);
+                    continue;
+                }
+                break;
+            case 0xd829688eu: // sizehint
+                if (tag.compare(QLatin1String("sizehint"), Qt::CaseInsensitive) == 0) {
+                    DomSize *v = new DomSize();
+                    v->read(reader);
+                    setElementSizeHint(v);
+                    continue;
+                }
+                break;
+            case 0xa4ee2c27u: // addpagemethod
+                if (tag.compare(QLatin1String("addpagemethod"), Qt::CaseInsensitive) == 0) {
+                    setElementAddPageMethod(reader.readElementText());
+                    continue;
+                }
+                break;
+            case 0xa5de42e3u: // container
+                if (tag.compare(QLatin1String("container"), Qt::CaseInsensitive) == 0) {
+                    setElementContainer(reader.readElementText().toInt());
+                    continue;
+                }
+                break;
+            case 0x9b3a61cbu: // sizepolicy
+                if (tag.compare(QLatin1String("sizepolicy"), Qt::CaseInsensitive) == 0) {
+                    DomSizePolicyData *v = new DomSizePolicyData();
+                    v->read(reader);
+                    setElementSizePolicy(v);
+                    continue;
+                }
+                break;
+            case 0x0cf17d6fu: // pixmap
+                if (tag.compare(QLatin1String("pixmap"), Qt::CaseInsensitive) == 0) {
+                    setElementPixmap(reader.readElementText());
+                    continue;
+                }
+                break;
+            case 0x13810af5u: // script
+                if (tag.compare(QLatin1String("script"), Qt::CaseInsensitive) == 0) {
+                    DomScript *v = new DomScript();
+                    v->read(reader);
+                    setElementScript(v);
+                    continue;
+                }
+                break;
+            case 0xb5f90bedu: // properties
+                if (tag.compare(QLatin1String("properties"), Qt::CaseInsensitive) == 0) {
+                    DomProperties *v = new DomProperties();
+                    v->read(reader);
+                    setElementProperties(v);
+                    continue;
+                }
+                break;
+            case 0x085e2275u: // slots
+                if (tag.compare(QLatin1String("slots"), Qt::CaseInsensitive) == 0) {
+                    DomSlots *v = new DomSlots();
+                    v->read(reader);
+                    setElementSlots(v);
+                    continue;
+                }
+                break;
+            default:
+                break;
             }
-            reader.raiseError(QLatin1String("Unexpected element ") + tag);
+            reader.raiseError(QLatin1String("Unexpected element ") + tag.toString());
         }
             break;
         case QXmlStreamReader::EndElement :
@@ -3168,14 +3434,20 @@ void DomProperties::read(QXmlStreamReader &reader)
     for (bool finished = false; !finished && !reader.hasError();) {
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
-            const QString tag = reader.name().toString().toLower();
-            if (tag == QLatin1String("property")) {
-                DomPropertyData *v = new DomPropertyData();
-                v->read(reader);
-                m_property.append(v);
-                continue;
+            const QStringRef tag = reader.name();
+            switch (tagHash(tag)) {
+            case 0xaf4cdd45u: // property
+                if (tag.compare(QLatin1String("property"), Qt::CaseInsensitive) == 0) {
+                    DomPropertyData *v = new DomPropertyData();
+                    v->read(reader);
+                    m_property.append(v);
+                    continue;
+                }
+                break;
+            default:
+                break;
             }
-            reader.raiseError(QLatin1String("Unexpected element ") + tag);
+            reader.raiseError(QLatin1String("Unexpected element ") + tag.toString());
         }
             break;
         case QXmlStreamReader::EndElement :
@@ -3270,8 +3542,8 @@ void DomPropertyData::read(QXmlStreamReader &reader)
     for (bool finished = false; !finished && !reader.hasError();) {
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
-            const QString tag = reader.name().toString().toLower();
-            reader.raiseError(QLatin1String("Unexpected element ") + tag);
+            const QStringRef tag = reader.name();
+            reader.raiseError(QLatin1String("Unexpected element ") + tag.toString());
         }
             break;
         case QXmlStreamReader::EndElement :
@@ -3349,16 +3621,24 @@ void DomSizePolicyData::read(QXmlStreamReader &reader)
     for (bool finished = false; !finished && !reader.hasError();) {
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
-            const QString tag = reader.name().toString().toLower();
-            if (tag == QLatin1String("hordata")) {
-                setElementHorData(reader.readElementText().toInt());
-                continue;
-            }
-            if (tag == QLatin1String("verdata")) {
-                setElementVerData(reader.readElementText().toInt());
-                continue;
+            const QStringRef tag = reader.name();
+            switch (tagHash(tag)) {
+            case 0x50dcb783u: // hordata
+                if (tag.compare(QLatin1String("hordata"), Qt::CaseInsensitive) == 0) {
+                    setElementHorData(reader.readElementText().toInt());
+                    continue;
+                }
+                break;
+            case 0x6f3873c7u: // verdata
+                if (tag.compare(QLatin1String("verdata"), Qt::CaseInsensitive) == 0) {
+                    setElementVerData(reader.readElementText().toInt());
+                    continue;
+                }
+                break;
+            default:
+                break;
             }
-            reader.raiseError(QLatin1String("Unexpected element ") + tag);
+            reader.raiseError(QLatin1String("Unexpected element ") + tag.toString());
         }
             break;
         case QXmlStreamReader::EndElement :
@@ -3485,8 +3765,8 @@ void DomLayoutDefault::read(QXmlStreamReader &reader)
     for (bool finished = false; !finished && !reader.hasError();) {
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
-            const QString tag = reader.name().toString().toLower();
-            reader.raiseError(QLatin1String("Unexpected element ") + tag);
+            const QStringRef tag = reader.name();
+            reader.raiseError(QLatin1String("Unexpected element ") + tag.toString());
         }
             break;
         case QXmlStreamReader::EndElement :
@@ -3582,8 +3862,8 @@ void DomLayoutFunction::read(QXmlStreamReader &reader)
     for (bool finished = false; !finished && !reader.hasError();) {
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
-            const QString tag = reader.name().toString().toLower();
-            reader.raiseError(QLatin1String("Unexpected element ") + tag);
+            const QStringRef tag = reader.name();
+            reader.raiseError(QLatin1String("Unexpected element ") + tag.toString());
         }
             break;
         case QXmlStreamReader::EndElement :
@@ -3664,12 +3944,18 @@ void DomTabStops::read(QXmlStreamReader &reader)
     for (bool finished = false; !finished && !reader.hasError();) {
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
-            const QString tag = reader.name().toString().toLower();
-            if (tag == QLatin1String("tabstop")) {
-                m_tabStop.append(reader.readElementText());
-                continue;
+            const QStringRef tag = reader.name();
+            switch (tagHash(tag)) {
+            case 0xcad6599du: // tabstop
+                if (tag.compare(QLatin1String("tabstop"), Qt::CaseInsensitive) == 0) {
+                    m_tabStop.append(reader.readElementText());
+                    continue;
+                }
+                break;
+            default:
+                break;
             }
-            reader.raiseError(QLatin1String("Unexpected element ") + tag);
+            reader.raiseError(QLatin1String("Unexpected element ") + tag.toString());
         }
             break;
         case QXmlStreamReader::EndElement :
@@ -3777,7 +4063,7 @@ void DomLayout::read(QXmlStreamReader &reader)
     foreach (const QXmlStreamAttribute &attribute, reader.attributes()) {
         QStringRef name = attribute.name();
         if (name == QLatin1String("class")) {
-            setAttributeClass(attribute.value().toString());
+            setAttributeClass(internString(attribute.value()));
             continue;
         }
         if (name == QLatin1String("name")) {
@@ -3810,26 +4096,36 @@ void DomLayout::read(QXmlStreamReader &reader)
     for (bool finished = false; !finished && !reader.hasError();) {
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
-            const QString tag = reader.name().toString().toLower();
-            if (tag == QLatin1String("property")) {
-                DomProperty *v = new DomProperty();
-                v->read(reader);
-                m_property.append(v);
-                continue;
-            }
-            if (tag == QLatin1String("attribute")) {
-                DomProperty *v = new DomProperty();
-                v->read(reader);
-                m_attribute.append(v);
-                continue;
-            }
-            if (tag == QLatin1String("item")) {
-                DomLayoutItem *v = new DomLayoutItem();
-                v->read(reader);
-                m_item.append(v);
-                continue;
+            const QStringRef tag = reader.name();
+            switch (tagHash(tag)) {
+            case 0xaf4cdd45u: // property
+                if (tag.compare(QLatin1String("property"), Qt::CaseInsensitive) == 0) {
+                    DomProperty *v = new DomProperty();
+                    v->read(reader);
+                    m_property.append(v);
+                    continue;
+                }
+                break;
+            case 0x23eeb194u: // attribute
+                if (tag.compare(QLatin1String("attribute"), Qt::CaseInsensitive) == 0) {
+                    DomProperty *v = new DomProperty();
+                    v->read(reader);
+                    m_attribute.append(v);
+                    continue;
+                }
+                break;
+            case 0x003b8eafu: // item
+                if (tag.compare(QLatin1String("item"), Qt::CaseInsensitive) == 0) {
+                    DomLayoutItem *v = new DomLayoutItem();
+                    v->read(reader);
+                    m_item.append(v);
+                    continue;
+                }
+                break;
+            default:
+                break;
             }
-            reader.raiseError(QLatin1String("Unexpected element ") + tag);
+            reader.raiseError(QLatin1String("Unexpected element ") + tag.toString());
         }
             break;
         case QXmlStreamReader::EndElement :
@@ -4032,26 +4328,36 @@ void DomLayoutItem::read(QXmlStreamReader &reader)
     for (bool finished = false; !finished && !reader.hasError();) {
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
-            const QString tag = reader.name().toString().toLower();
-            if (tag == QLatin1String("widget")) {
-                DomWidget *v = new DomWidget();
-                v->read(reader);
-                setElementWidget(v);
-                continue;
-            }
-            if (tag == QLatin1String("layout")) {
-                DomLayout *v = new DomLayout();
-                v->read(reader);
-                setElementLayout(v);
-                continue;
-            }
-            if (tag == QLatin1String("spacer")) {
-                DomSpacer *v = new DomSpacer();
-                v->read(reader);
-                setElementSpacer(v);
-                continue;
+            const QStringRef tag = reader.name();
+            switch (tagHash(tag)) {
+            case 0x1d3a8944u: // widget
+                if (tag.compare(QLatin1String("widget"), Qt::CaseInsensitive) == 0) {
+                    DomWidget *v = new DomWidget();
+                    v->read(reader);
+                    setElementWidget(v);
+                    continue;
+                }
+                break;
+            case 0x030cae5eu: // layout
+                if (tag.compare(QLatin1String("layout"), Qt::CaseInsensitive) == 0) {
+                    DomLayout *v = new DomLayout();
+                    v->read(reader);
+                    setElementLayout(v);
+                    continue;
+                }
+                break;
+            case 0x1462dc1eu: // spacer
+                if (tag.compare(QLatin1String("spacer"), Qt::CaseInsensitive) == 0) {
+                    DomSpacer *v = new DomSpacer();
+                    v->read(reader);
+                    setElementSpacer(v);
+                    continue;
+                }
+                break;
+            default:
+                break;
             }
-            reader.raiseError(QLatin1String("Unexpected element ") + tag);
+            reader.raiseError(QLatin1String("Unexpected element ") + tag.toString());
         }
             break;
         case QXmlStreamReader::EndElement :
@@ -4229,14 +4535,20 @@ void DomRow::read(QXmlStreamReader &reader)
     for (bool finished = false; !finished && !reader.hasError();) {
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
-            const QString tag = reader.name().toString().toLower();
-            if (tag == QLatin1String("property")) {
-                DomProperty *v = new DomProperty();
-                v->read(reader);
-                m_property.append(v);
-                continue;
+            const QStringRef tag = reader.name();
+            switch (tagHash(tag)) {
+            case 0xaf4cdd45u: // property
+                if (tag.compare(QLatin1String("property"), Qt::CaseInsensitive) == 0) {
+                    DomProperty *v = new DomProperty();
+                    v->read(reader);
+                    m_property.append(v);
+                    continue;
+                }
+                break;
+            default:
+                break;
             }
-            reader.raiseError(QLatin1String("Unexpected element ") + tag);
+            reader.raiseError(QLatin1String("Unexpected element ") + tag.toString());
         }
             break;
         case QXmlStreamReader::EndElement :
@@ -4324,14 +4636,20 @@ void DomColumn::read(QXmlStreamReader &reader)
     for (bool finished = false; !finished && !reader.hasError();) {
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
-            const QString tag = reader.name().toString().toLower();
-            if (tag == QLatin1String("property")) {
-                DomProperty *v = new DomProperty();
-                v->read(reader);
-                m_property.append(v);
-                continue;
+            const QStringRef tag = reader.name();
+            switch (tagHash(tag)) {
+            case 0xaf4cdd45u: // property
+                if (tag.compare(QLatin1String("property"), Qt::CaseInsensitive) == 0) {
+                    DomProperty *v = new DomProperty();
+                    v->read(reader);
+                    m_property.append(v);
+                    continue;
+                }
+                break;
+            default:
+                break;
             }
-            reader.raiseError(QLatin1String("Unexpected element ") + tag);
+            reader.raiseError(QLatin1String("Unexpected element ") + tag.toString());
         }
             break;
         case QXmlStreamReader::EndElement :
@@ -4444,20 +4762,28 @@ void DomItem::read(QXmlStreamReader &reader)
     for (bool finished = false; !finished && !reader.hasError();) {
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
-            const QString tag = reader.name().toString().toLower();
-            if (tag == QLatin1String("property")) {
-                DomProperty *v = new DomProperty();
-                v->read(reader);
-                m_property.append(v);
-                continue;
-            }
-            if (tag == QLatin1String("item")) {
-                DomItem *v = new DomItem();
-                v->read(reader);
-                m_item.append(v);
-                continue;
+            const QStringRef tag = reader.name();
+            switch (tagHash(tag)) {
+            case 0xaf4cdd45u: // property
+                if (tag.compare(QLatin1String("property"), Qt::CaseInsensitive) == 0) {
+                    DomProperty *v = new DomProperty();
+                    v->read(reader);
+                    m_property.append(v);
+                    continue;
+                }
+                break;
+            case 0x003b8eafu: // item
+                if (tag.compare(QLatin1String("item"), Qt::CaseInsensitive) == 0) {
+                    DomItem *v = new DomItem();
+                    v->read(reader);
+                    m_item.append(v);
+                    continue;
+                }
+                break;
+            default:
+                break;
             }
-            reader.raiseError(QLatin1String("Unexpected element ") + tag);
+            reader.raiseError(QLatin1String("Unexpected element ") + tag.toString());
         }
             break;
         case QXmlStreamReader::EndElement :
@@ -4628,7 +4954,7 @@ void DomWidget::read(QXmlStreamReader &reader)
     foreach (const QXmlStreamAttribute &attribute, reader.attributes()) {
         QStringRef name = attribute.name();
         if (name == QLatin1String("class")) {
-            setAttributeClass(attribute.value().toString());
+            setAttributeClass(internString(attribute.value()));
             continue;
         }
         if (name == QLatin1String("name")) {
@@ -4645,88 +4971,120 @@ void DomWidget::read(QXmlStreamReader &reader)
     for (bool finished = false; !finished && !reader.hasError();) {
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
-            const QString tag = reader.name().toString().toLower();
-            if (tag == QLatin1String("class")) {
-                m_class.append(reader.readElementText());
-                continue;
-            }
-            if (tag == QLatin1String("property")) {
-                DomProperty *v = new DomProperty();
-                v->read(reader);
-                m_property.append(v);
-                continue;
-            }
-            if (tag == QLatin1String("script")) {
-                DomScript *v = new DomScript();
-                v->read(reader);
-                m_script.append(v);
-                continue;
-            }
-            if (tag == QLatin1String("widgetdata")) {
-                DomWidgetData *v = new DomWidgetData();
-                v->read(reader);
-                m_widgetData.append(v);
-                continue;
-            }
-            if (tag == QLatin1String("attribute")) {
-                DomProperty *v = new DomProperty();
-                v->read(reader);
-                m_attribute.append(v);
-                continue;
-            }
-            if (tag == QLatin1String("row")) {
-                DomRow *v = new DomRow();
-                v->read(reader);
-                m_row.append(v);
-                continue;
-            }
-            if (tag == QLatin1String("column")) {
-                DomColumn *v = new DomColumn();
-                v->read(reader);
-                m_column.append(v);
-                continue;
-            }
-            if (tag == QLatin1String("item")) {
-                DomItem *v = new DomItem();
-                v->read(reader);
-                m_item.append(v);
-                continue;
-            }
-            if (tag == QLatin1String("layout")) {
-                DomLayout *v = new DomLayout();
-                v->read(reader);
-                m_layout.append(v);
-                continue;
-            }
-            if (tag == QLatin1String("widget")) {
-                DomWidget *v = new DomWidget();
-                v->read(reader);
-                m_widget.append(v);
-                continue;
-            }
-            if (tag == QLatin1String("action")) {
-                DomAction *v = new DomAction();
-                v->read(reader);
-                m_action.append(v);
-                continue;
-            }
-            if (tag == QLatin1String("actiongroup")) {
-                DomActionGroup *v = new DomActionGroup();
-                v->read(reader);
-                m_actionGroup.append(v);
-                continue;
-            }
-            if (tag == QLatin1String("addaction")) {
-                DomActionRef *v = new DomActionRef();
-                v->read(reader);
-                m_addAction.append(v);
-                continue;
-            }
-            if (tag == QLatin1String("zorder")) {
-                m_zOrder.append(reader.readElementText());
-                continue;
+            const QStringRef tag = reader.name();
+            switch (tagHash(tag)) {
+            case 0x073c5eb6u: // class
+                if (tag.compare(QLatin1String("class"), Qt::CaseInsensitive) == 0) {
+                    m_class.append(reader.readElementText());
+                    continue;
+                }
+                break;
+            case 0xaf4cdd45u: // property
+                if (tag.compare(QLatin1String("property"), Qt::CaseInsensitive) == 0) {
+                    DomProperty *v = new DomProperty();
+                    v->read(reader);
+                    m_property.append(v);
+                    continue;
+                }
+                break;
+            case 0x13810af5u: // script
+                if (tag.compare(QLatin1String("script"), Qt::CaseInsensitive) == 0) {
+                    DomScript *v = new DomScript();
+                    v->read(reader);
+                    m_script.append(v);
+                    continue;
+                }
+                break;
+            case 0xde5e0d1eu: // widgetdata
+                if (tag.compare(QLatin1String("widgetdata"), Qt::CaseInsensitive) == 0) {
+                    DomWidgetData *v = new DomWidgetData();
+                    v->read(reader);
+                    m_widgetData.append(v);
+                    continue;
+                }
+                break;
+            case 0x23eeb194u: // attribute
+                if (tag.compare(QLatin1String("attribute"), Qt::CaseInsensitive) == 0) {
+                    DomProperty *v = new DomProperty();
+                    v->read(reader);
+                    m_attribute.append(v);
+                    continue;
+                }
+                break;
+            case 0x0001f3b8u: // row
+                if (tag.compare(QLatin1String("row"), Qt::CaseInsensitive) == 0) {
+                    DomRow *v = new DomRow();
+                    v->read(reader);
+                    m_row.append(v);
+                    continue;
+                }
+                break;
+            case 0xef048f4eu: // column
+                if (tag.compare(QLatin1String("column"), Qt::CaseInsensitive) == 0) {
+                    DomColumn *v = new DomColumn();
+                    v->read(reader);
+                    m_column.append(v);
+                    continue;
+                }
+                break;
+            case 0x003b8eafu: // item
+                if (tag.compare(QLatin1String("item"), Qt::CaseInsensitive) == 0) {
+                    DomItem *v = new DomItem();
+                    v->read(reader);
+                    m_item.append(v);
+                    continue;
+                }
+                break;
+            case 0x030cae5eu: // layout
+                if (tag.compare(QLatin1String("layout"), Qt::CaseInsensitive) == 0) {
+                    DomLayout *v = new DomLayout();
+                    v->read(reader);
+                    m_layout.append(v);
+                    continue;
+                }
+                break;
+            case 0x1d3a8944u: // widget
+                if (tag.compare(QLatin1String("widget"), Qt::CaseInsensitive) == 0) {
+                    DomWidget *v = new DomWidget();
+                    v->read(reader);
+                    m_widget.append(v);
+                    continue;
+                }
+                break;
+            case 0xe985483eu: // action
+                if (tag.compare(QLatin1String("action"), Qt::CaseInsensitive) == 0) {
+                    DomAction *v = new DomAction();
+                    v->read(reader);
+                    m_action.append(v);
+                    continue;
+                }
+                break;
+            case 0x303a65cbu: // actiongroup
+                if (tag.compare(QLatin1String("actiongroup"), Qt::CaseInsensitive) == 0) {
+                    DomActionGroup *v = new DomActionGroup();
+                    v->read(reader);
+                    m_actionGroup.append(v);
+                    continue;
+                }
+                break;
+            case 0x6822fce7u: // addaction
+                if (tag.compare(QLatin1String("addaction"), Qt::CaseInsensitive) == 0) {
+                    DomActionRef *v = new DomActionRef();
+                    v->read(reader);
+                    m_addAction.append(v);
+                    continue;
+                }
+                break;
+            case 0x24ae36b6u: // zorder
+                if (tag.compare(QLatin1String("zorder"), Qt::CaseInsensitive) == 0) {
+                    m_zOrder.append(reader.readElementText());
+                    continue;
+                }
+                break;
+            default:
+                break;
             }
-            reader.raiseError(QLatin1String("Unexpected element ") + tag);
+            reader.raiseError(QLatin1String("Unexpected element ") + tag.toString());
         }
             break;
         case QXmlStreamReader::EndElement :
@@ -5045,14 +5403,20 @@ void DomSpacer::read(QXmlStreamReader &reader)
     for (bool finished = false; !finished && !reader.hasError();) {
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
-            const QString tag = reader.name().toString().toLower();
-            if (tag == QLatin1String("property")) {
-                DomProperty *v = new DomProperty();
-                v->read(reader);
-                m_property.append(v);
-                continue;
+            const QStringRef tag = reader.name();
+            switch (tagHash(tag)) {
+            case 0xaf4cdd45u: // property
+                if (tag.compare(QLatin1String("property"), Qt::CaseInsensitive) == 0) {
+                    DomProperty *v = new DomProperty();
+                    v->read(reader);
+                    m_property.append(v);
+                    continue;
+                }
+                break;
+            default:
+                break;
             }
-            reader.raiseError(QLatin1String("Unexpected element ") + tag);
+            reader.raiseError(QLatin1String("Unexpected element ") + tag.toString());
         }
             break;
         case QXmlStreamReader::EndElement :
@@ -5161,20 +5525,30 @@ void DomColor::read(QXmlStreamReader &reader)
     for (bool finished = false; !finished && !reader.hasError();) {
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
-            const QString tag = reader.name().toString().toLower();
-            if (tag == QLatin1String("red")) {
-                setElementRed(reader.readElementText().toInt());
-                continue;
-            }
-            if (tag == QLatin1String("green")) {
-                setElementGreen(reader.readElementText().toInt());
-                continue;
-            }
-            if (tag == QLatin1String("blue")) {
-                setElementBlue(reader.readElementText().toInt());
-                continue;
+            const QStringRef tag = reader.name();
+            switch (tagHash(tag)) {
+            case 0x0001f25bu: // red
+                if (tag.compare(QLatin1String("red"), Qt::CaseInsensitive) == 0) {
+                    setElementRed(reader.readElementText().toInt());
+                    continue;
+                }
+                break;
+            case 0x07881a31u: // green
+                if (tag.compare(QLatin1String("green"), Qt::CaseInsensitive) == 0) {
+                    setElementGreen(reader.readElementText().toInt());
+                    continue;
+                }
+                break;
+            case 0x00379808u: // blue
+                if (tag.compare(QLatin1String("blue"), Qt::CaseInsensitive) == 0) {
+                    setElementBlue(reader.readElementText().toInt());
+                    continue;
+                }
+                break;
+            default:
+                break;
             }
-            reader.raiseError(QLatin1String("Unexpected element ") + tag);
+            reader.raiseError(QLatin1String("Unexpected element ") + tag.toString());
         }
             break;
         case QXmlStreamReader::EndElement :
@@ -5322,14 +5696,20 @@ void DomGradientStop::read(QXmlStreamReader &reader)
     for (bool finished = false; !finished && !reader.hasError();) {
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
-            const QString tag = reader.name().toString().toLower();
-            if (tag == QLatin1String("color")) {
-                DomColor *v = new DomColor();
-                v->read(reader);
-                setElementColor(v);
-                continue;
+            const QStringRef tag = reader.name();
+            switch (tagHash(tag)) {
+            case 0x073e321fu: // color
+                if (tag.compare(QLatin1String("color"), Qt::CaseInsensitive) == 0) {
+                    DomColor *v = new DomColor();
+                    v->read(reader);
+                    setElementColor(v);
+                    continue;
+                }
+                break;
+            default:
+                break;
             }
-            reader.raiseError(QLatin1String("Unexpected element ") + tag);
+            reader.raiseError(QLatin1String("Unexpected element ") + tag.toString());
         }
             break;
         case QXmlStreamReader::EndElement :
@@ -5542,14 +5922,20 @@ void DomGradient::read(QXmlStreamReader &reader)
     for (bool finished = false; !finished && !reader.hasError();) {
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
-            const QString tag = reader.name().toString().toLower();
-            if (tag == QLatin1String("gradientstop")) {
-                DomGradientStop *v = new DomGradientStop();
-                v->read(reader);
-                m_gradientStop.append(v);
-                continue;
+            const QStringRef tag = reader.name();
+            switch (tagHash(tag)) {
+            case 0x6c964eb4u: // gradientstop
+                if (tag.compare(QLatin1String("gradientstop"), Qt::CaseInsensitive) == 0) {
+                    DomGradientStop *v = new DomGradientStop();
+                    v->read(reader);
+                    m_gradientStop.append(v);
+                    continue;
+                }
+                break;
+            default:
+                break;
             }
-            reader.raiseError(QLatin1String("Unexpected element ") + tag);
+            reader.raiseError(QLatin1String("Unexpected element ") + tag.toString());
         }
             break;
         case QXmlStreamReader::EndElement :
@@ -5724,26 +6110,36 @@ void DomBrush::read(QXmlStreamReader &reader)
     for (bool finished = false; !finished && !reader.hasError();) {
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
-            const QString tag = reader.name().toString().toLower();
-            if (tag == QLatin1String("color")) {
-                DomColor *v = new DomColor();
-                v->read(reader);
-                setElementColor(v);
-                continue;
-            }
-            if (tag == QLatin1String("texture")) {
-                DomProperty *v = new DomProperty();
-                v->read(reader);
-                setElementTexture(v);
-                continue;
-            }
-            if (tag == QLatin1String("gradient")) {
-                DomGradient *v = new DomGradient();
-                v->read(reader);
-                setElementGradient(v);
-                continue;
+            const QStringRef tag = reader.name();
+            switch (tagHash(tag)) {
+            case 0x073e321fu: // color
+                if (tag.compare(QLatin1String("color"), Qt::CaseInsensitive) == 0) {
+                    DomColor *v = new DomColor();
+                    v->read(reader);
+                    setElementColor(v);
+                    continue;
+                }
+                break;
+            case 0xd5b9a831u: // texture
+                if (tag.compare(QLatin1String("texture"), Qt::CaseInsensitive) == 0) {
+                    DomProperty *v = new DomProperty();
+                    v->read(reader);
+                    setElementTexture(v);
+                    continue;
+                }
+                break;
+            case 0x3f7cfbeeu: // gradient
+                if (tag.compare(QLatin1String("gradient"), Qt::CaseInsensitive) == 0) {
+                    DomGradient *v = new DomGradient();
+                    v->read(reader);
+                    setElementGradient(v);
+                    continue;
+                }
+                break;
+            default:
+                break;
             }
-            reader.raiseError(QLatin1String("Unexpected element ") + tag);
+            reader.raiseError(QLatin1String("Unexpected element ") + tag.toString());
         }
             break;
         case QXmlStreamReader::EndElement :
@@ -5917,14 +6313,20 @@ void DomColorRole::read(QXmlStreamReader &reader)
     for (bool finished = false; !finished && !reader.hasError();) {
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
-            const QString tag = reader.name().toString().toLower();
-            if (tag == QLatin1String("brush")) {
-                DomBrush *v = new DomBrush();
-                v->read(reader);
-                setElementBrush(v);
-                continue;
+            const QStringRef tag = reader.name();
+            switch (tagHash(tag)) {
+            case 0x072de584u: // brush
+                if (tag.compare(QLatin1String("brush"), Qt::CaseInsensitive) == 0) {
+                    DomBrush *v = new DomBrush();
+                    v->read(reader);
+                    setElementBrush(v);
+                    continue;
+                }
+                break;
+            default:
+                break;
             }
-            reader.raiseError(QLatin1String("Unexpected element ") + tag);
+            reader.raiseError(QLatin1String("Unexpected element ") + tag.toString());
         }
             break;
         case QXmlStreamReader::EndElement :
@@ -6038,20 +6440,28 @@ void DomColorGroup::read(QXmlStreamReader &reader)
     for (bool finished = false; !finished && !reader.hasError();) {
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
-            const QString tag = reader.name().toString().toLower();
-            if (tag == QLatin1String("colorrole")) {
-                DomColorRole *v = new DomColorRole();
-                v->read(reader);
-                m_colorRole.append(v);
-                continue;
-            }
-            if (tag == QLatin1String("color")) {
-                DomColor *v = new DomColor();
-                v->read(reader);
-                m_color.append(v);
-                continue;
+            const QStringRef tag = reader.name();
+            switch (tagHash(tag)) {
+            case 0x01789351u: // colorrole
+                if (tag.compare(QLatin1String("colorrole"), Qt::CaseInsensitive) == 0) {
+                    DomColorRole *v = new DomColorRole();
+                    v->read(reader);
+                    m_colorRole.append(v);
+                    continue;
+                }
+                break;
+            case 0x073e321fu: // color
+                if (tag.compare(QLatin1String("color"), Qt::CaseInsensitive) == 0) {
+                    DomColor *v = new DomColor();
+                    v->read(reader);
+                    m_color.append(v);
+                    continue;
+                }
+                break;
+            default:
+                break;
             }
-            reader.raiseError(QLatin1String("Unexpected element ") + tag);
+            reader.raiseError(QLatin1String("Unexpected element ") + tag.toString());
         }
             break;
         case QXmlStreamReader::EndElement :
@@ -6163,26 +6573,36 @@ void DomPalette::read(QXmlStreamReader &reader)
     for (bool finished = false; !finished && !reader.hasError();) {
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
-            const QString tag = reader.name().toString().toLower();
-            if (tag == QLatin1String("active")) {
-                DomColorGroup *v = new DomColorGroup();
-                v->read(reader);
-                setElementActive(v);
-                continue;
-            }
-            if (tag == QLatin1String("inactive")) {
-                DomColorGroup *v = new DomColorGroup();
-                v->read(reader);
-                setElementInactive(v);
-                continue;
-            }
-            if (tag == QLatin1String("disabled")) {
-                DomColorGroup *v = new DomColorGroup();
-                v->read(reader);
-                setElementDisabled(v);
-                continue;
+            const QStringRef tag = reader.name();
+            switch (tagHash(tag)) {
+            case 0xe985491cu: // active
+                if (tag.compare(QLatin1String("active"), Qt::CaseInsensitive) == 0) {
+                    DomColorGroup *v = new DomColorGroup();
+                    v->read(reader);
+                    setElementActive(v);
+                    continue;
+                }
+                break;
+            case 0xe40bb453u: // inactive
+                if (tag.compare(QLatin1String("inactive"), Qt::CaseInsensitive) == 0) {
+                    DomColorGroup *v = new DomColorGroup();
+                    v->read(reader);
+                    setElementInactive(v);
+                    continue;
+                }
+                break;
+            case 0xefae3238u: // disabled
+                if (tag.compare(QLatin1String("disabled"), Qt::CaseInsensitive) == 0) {
+                    DomColorGroup *v = new DomColorGroup();
+                    v->read(reader);
+                    setElementDisabled(v);
+                    continue;
+                }
+                break;
+            default:
+                break;
             }
-            reader.raiseError(QLatin1String("Unexpected element ") + tag);
+            reader.raiseError(QLatin1String("Unexpected element ") + tag.toString());
         }
             break;
         case QXmlStreamReader::EndElement :
@@ -6362,48 +6782,72 @@ void DomFont::read(QXmlStreamReader &reader)
     for (bool finished = false; !finished && !reader.hasError();) {
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
-            const QString tag = reader.name().toString().toLower();
-            if (tag == QLatin1String("family")) {
-                setElementFamily(reader.readElementText());
-                continue;
-            }
-            if (tag == QLatin1String("pointsize")) {
-                setElementPointSize(reader.readElementText().toInt());
-                continue;
-            }
-            if (tag == QLatin1String("weight")) {
-                setElementWeight(reader.readElementText().toInt());
-                continue;
-            }
-            if (tag == QLatin1String("italic")) {
-                setElementItalic((reader.readElementText() == QLatin1String("true") ? true : false));
-                continue;
-            }
-            if (tag == QLatin1String("bold")) {
-                setElementBold((reader.readElementText() == QLatin1String("true") ? true : false));
-                continue;
-            }
-            if (tag == QLatin1String("underline")) {
-                setElementUnderline((reader.readElementText() == QLatin1String("true") ? true : false));
-                continue;
-            }
-            if (tag == QLatin1String("strikeout")) {
-                setElementStrikeOut((reader.readElementText() == QLatin1String("true") ? true : false));
-                continue;
-            }
-            if (tag == QLatin1String("antialiasing")) {
-                setElementAntialiasing((reader.readElementText() == QLatin1String("true") ? true : false));
-                continue;
-            }
-            if (tag == QLatin1String("stylestrategy")) {
-                setElementStyleStrategy(reader.readElementText());
-                continue;
-            }
-            if (tag == QLatin1String("kerning")) {
-                setElementKerning((reader.readElementText() == QLatin1String("true") ? true : false));
-                continue;
+            const QStringRef tag = reader.name();
+            switch (tagHash(tag)) {
+            case 0xf5070b62u: // family
+                if (tag.compare(QLatin1String("family"), Qt::CaseInsensitive) == 0) {
+                    setElementFamily(reader.readElementText());
+                    continue;
+                }
+                break;
+            case 0x02ab1725u: // pointsize
+                if (tag.compare(QLatin1String("pointsize"), Qt::CaseInsensitive) == 0) {
+                    setElementPointSize(reader.readElementText().toInt());
+                    continue;
+                }
+                break;
+            case 0x1cf4e588u: // weight
+                if (tag.compare(QLatin1String("weight"), Qt::CaseInsensitive) == 0) {
+                    setElementWeight(reader.readElementText().toInt());
+                    continue;
+                }
+                break;
+            case 0xfd57ce96u: // italic
+                if (tag.compare(QLatin1String("italic"), Qt::CaseInsensitive) == 0) {
+                    setElementItalic((reader.readElementText() == QLatin1String("true") ? true : false));
+                    continue;
+                }
+                break;
+            case 0x0037a3a1u: // bold
+                if (tag.compare(QLatin1String("bold"), Qt::CaseInsensitive) == 0) {
+                    setElementBold((reader.readElementText() == QLatin1String("true") ? true : false));
+                    continue;
+                }
+                break;
+            case 0xc6cdd0a6u: // underline
+                if (tag.compare(QLatin1String("underline"), Qt::CaseInsensitive) == 0) {
+                    setElementUnderline((reader.readElementText() == QLatin1String("true") ? true : false));
+                    continue;
+                }
+                break;
+            case 0xa5e1794au: // strikeout
+                if (tag.compare(QLatin1String("strikeout"), Qt::CaseInsensitive) == 0) {
+                    setElementStrikeOut((reader.readElementText() == QLatin1String("true") ? true : false));
+                    continue;
+                }
+                break;
+            case 0x706d7a74u: // antialiasing
+                if (tag.compare(QLatin1String("antialiasing"), Qt::CaseInsensitive) == 0) {
+                    setElementAntialiasing((reader.readElementText() == QLatin1String("true") ? true : false));
+                    continue;
+                }
+                break;
+            case 0x9c55f064u: // stylestrategy
+                if (tag.compare(QLatin1String("stylestrategy"), Qt::CaseInsensitive) == 0) {
+                    setElementStyleStrategy(reader.readElementText());
+                    continue;
+                }
+                break;
+            case 0x207d748eu: // kerning
+                if (tag.compare(QLatin1String("kerning"), Qt::CaseInsensitive) == 0) {
+                    setElementKerning((reader.readElementText() == QLatin1String("true") ? true : false));
+                    continue;
+                }
+                break;
+            default:
+                break;
             }
-            reader.raiseError(QLatin1String("Unexpected element ") + tag);
+            reader.raiseError(QLatin1String("Unexpected element ") + tag.toString());
         }
             break;
         case QXmlStreamReader::EndElement :
@@ -6665,16 +7109,24 @@ void DomPoint::read(QXmlStreamReader &reader)
     for (bool finished = false; !finished && !reader.hasError();) {
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
-            const QString tag = reader.name().toString().toLower();
-            if (tag == QString(QLatin1Char('x'))) {
-                setElementX(reader.readElementText().toInt());
-                continue;
-            }
-            if (tag == QString(QLatin1Char('y'))) {
-                setElementY(reader.readElementText().toInt());
-                continue;
+            const QStringRef tag = reader.name();
+            switch (tagHash(tag)) {
+            case 0x00000078u: // x
+                if (tag.compare(QLatin1String("x"), Qt::CaseInsensitive) == 0) {
+                    setElementX(reader.readElementText().toInt());
+                    continue;
+                }
+                break;
+            case 0x00000079u: // y
+                if (tag.compare(QLatin1String("y"), Qt::CaseInsensitive) == 0) {
+                    setElementY(reader.readElementText().toInt());
+                    continue;
+                }
+                break;
+            default:
+                break;
             }
-            reader.raiseError(QLatin1String("Unexpected element ") + tag);
+            reader.raiseError(QLatin1String("Unexpected element ") + tag.toString());
         }
             break;
         case QXmlStreamReader::EndElement :
@@ -6788,24 +7240,36 @@ void DomRect::read(QXmlStreamReader &reader)
     for (bool finished = false; !finished && !reader.hasError();) {
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
-            const QString tag = reader.name().toString().toLower();
-            if (tag == QString(QLatin1Char('x'))) {
-                setElementX(reader.readElementText().toInt());
-                continue;
-            }
-            if (tag == QString(QLatin1Char('y'))) {
-                setElementY(reader.readElementText().toInt());
-                continue;
-            }
-            if (tag == QLatin1String("width")) {
-                setElementWidth(reader.readElementText().toInt());
-                continue;
-            }
-            if (tag == QLatin1String("height")) {
-                setElementHeight(reader.readElementText().toInt());
-                continue;
+            const QStringRef tag = reader.name();
+            switch (tagHash(tag)) {
+            case 0x00000078u: // x
+                if (tag.compare(QLatin1String("x"), Qt::CaseInsensitive) == 0) {
+                    setElementX(reader.readElementText().toInt());
+                    continue;
+                }
+                break;
+            case 0x00000079u: // y
+                if (tag.compare(QLatin1String("y"), Qt::CaseInsensitive) == 0) {
+                    setElementY(reader.readElementText().toInt());
+                    continue;
+                }
+                break;
+            case 0x08a4b080u: // width
+                if (tag.compare(QLatin1String("width"), Qt::CaseInsensitive) == 0) {
+                    setElementWidth(reader.readElementText().toInt());
+                    continue;
+                }
+                break;
+            case 0xf9f78419u: // height
+                if (tag.compare(QLatin1String("height"), Qt::CaseInsensitive) == 0) {
+                    setElementHeight(reader.readElementText().toInt());
+                    continue;
+                }
+                break;
+            default:
+                break;
             }
-            reader.raiseError(QLatin1String("Unexpected element ") + tag);
+            reader.raiseError(QLatin1String("Unexpected element ") + tag.toString());
         }
             break;
         case QXmlStreamReader::EndElement :
@@ -6966,8 +7430,8 @@ void DomLocale::read(QXmlStreamReader &reader)
     for (bool finished = false; !finished && !reader.hasError();) {
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
-            const QString tag = reader.name().toString().toLower();
-            reader.raiseError(QLatin1String("Unexpected element ") + tag);
+            const QStringRef tag = reader.name();
+            reader.raiseError(QLatin1String("Unexpected element ") + tag.toString());
         }
             break;
         case QXmlStreamReader::EndElement :
@@ -7071,24 +7535,36 @@ void DomSizePolicy::read(QXmlStreamReader &reader)
     for (bool finished = false; !finished && !reader.hasError();) {
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
-            const QString tag = reader.name().toString().toLower();
-            if (tag == QLatin1String("hsizetype")) {
-                setElementHSizeType(reader.readElementText().toInt());
-                continue;
-            }
-            if (tag == QLatin1String("vsizetype")) {
-                setElementVSizeType(reader.readElementText().toInt());
-                continue;
-            }
-            if (tag == QLatin1String("horstretch")) {
-                setElementHorStretch(reader.readElementText().toInt());
-                continue;
-            }
-            if (tag == QLatin1String("verstretch")) {
-                setElementVerStretch(reader.readElementText().toInt());
-                continue;
+            const QStringRef tag = reader.name();
+            switch (tagHash(tag)) {
+            case 0x2abe29c5u: // hsizetype
+                if (tag.compare(QLatin1String("hsizetype"), Qt::CaseInsensitive) == 0) {
+                    setElementHSizeType(reader.readElementText().toInt());
+                    continue;
+                }
+                break;
+            case 0x898c57d3u: // vsizetype
+                if (tag.compare(QLatin1String("vsizetype"), Qt::CaseInsensitive) == 0) {
+                    setElementVSizeType(reader.readElementText().toInt());
+                    continue;
+                }
+                break;
+            case 0x06d8bb06u: // horstretch
+                if (tag.compare(QLatin1String("horstretch"), Qt::CaseInsensitive) == 0) {
+                    setElementHorStretch(reader.readElementText().toInt());
+                    continue;
+                }
+                break;
+            case 0xb29040cau: // verstretch
+                if (tag.compare(QLatin1String("verstretch"), Qt::CaseInsensitive) == 0) {
+                    setElementVerStretch(reader.readElementText().toInt());
+                    continue;
+                }
+                break;
+            default:
+                break;
             }
-            reader.raiseError(QLatin1String("Unexpected element ") + tag);
+            reader.raiseError(QLatin1String("Unexpected element ") + tag.toString());
         }
             break;
         case QXmlStreamReader::EndElement :
@@ -7247,16 +7723,24 @@ void DomSize::read(QXmlStreamReader &reader)
     for (bool finished = false; !finished && !reader.hasError();) {
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
-            const QString tag = reader.name().toString().toLower();
-            if (tag == QLatin1String("width")) {
-                setElementWidth(reader.readElementText().toInt());
-                continue;
-            }
-            if (tag == QLatin1String("height")) {
-                setElementHeight(reader.readElementText().toInt());
-                continue;
+            const QStringRef tag = reader.name();
+            switch (tagHash(tag)) {
+            case 0x08a4b080u: // width
+                if (tag.compare(QLatin1String("width"), Qt::CaseInsensitive) == 0) {
+                    setElementWidth(reader.readElementText().toInt());
+                    continue;
+                }
+                break;
+            case 0xf9f78419u: // height
+                if (tag.compare(QLatin1String("height"), Qt::CaseInsensitive) == 0) {
+                    setElementHeight(reader.readElementText().toInt());
+                    continue;
+                }
+                break;
+            default:
+                break;
             }
-            reader.raiseError(QLatin1String("Unexpected element ") + tag);
+            reader.raiseError(QLatin1String("Unexpected element ") + tag.toString());
         }
             break;
         case QXmlStreamReader::EndElement :
@@ -7368,20 +7852,30 @@ void DomDate::read(QXmlStreamReader &reader)
     for (bool finished = false; !finished && !reader.hasError();) {
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
-            const QString tag = reader.name().toString().toLower();
-            if (tag == QLatin1String("year")) {
-                setElementYear(reader.readElementText().toInt());
-                continue;
-            }
-            if (tag == QLatin1String("month")) {
-                setElementMonth(reader.readElementText().toInt());
-                continue;
-            }
-            if (tag == QLatin1String("day")) {
-                setElementDay(reader.readElementText().toInt());
-                continue;
+            const QStringRef tag = reader.name();
+            switch (tagHash(tag)) {
+            case 0x00441471u: // year
+                if (tag.compare(QLatin1String("year"), Qt::CaseInsensitive) == 0) {
+                    setElementYear(reader.readElementText().toInt());
+                    continue;
+                }
+                break;
+            case 0x07f33046u: // month
+                if (tag.compare(QLatin1String("month"), Qt::CaseInsensitive) == 0) {
+                    setElementMonth(reader.readElementText().toInt());
+                    continue;
+                }
+                break;
+            case 0x0001b65eu: // day
+                if (tag.compare(QLatin1String("day"), Qt::CaseInsensitive) == 0) {
+                    setElementDay(reader.readElementText().toInt());
+                    continue;
+                }
+                break;
+            default:
+                break;
             }
-            reader.raiseError(QLatin1String("Unexpected element ") + tag);
+            reader.raiseError(QLatin1String("Unexpected element ") + tag.toString());
         }
             break;
         case QXmlStreamReader::EndElement :
@@ -7512,20 +8006,30 @@ void DomTime::read(QXmlStreamReader &reader)
     for (bool finished = false; !finished && !reader.hasError();) {
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
-            const QString tag = reader.name().toString().toLower();
-            if (tag == QLatin1String("hour")) {
-                setElementHour(reader.readElementText().toInt());
-                continue;
-            }
-            if (tag == QLatin1String("minute")) {
-                setElementMinute(reader.readElementText().toInt());
-                continue;
-            }
-            if (tag == QLatin1String("second")) {
-                setElementSecond(reader.readElementText().toInt());
-                continue;
+            const QStringRef tag = reader.name();
+            switch (tagHash(tag)) {
+            case 0x003aef1eu: // hour
+                if (tag.compare(QLatin1String("hour"), Qt::CaseInsensitive) == 0) {
+                    setElementHour(reader.readElementText().toInt());
+                    continue;
+                }
+                break;
+            case 0x05ecac32u: // minute
+                if (tag.compare(QLatin1String("minute"), Qt::CaseInsensitive) == 0) {
+                    setElementMinute(reader.readElementText().toInt());
+                    continue;
+                }
+                break;
+            case 0x139d1b7cu: // second
+                if (tag.compare(QLatin1String("second"), Qt::CaseInsensitive) == 0) {
+                    setElementSecond(reader.readElementText().toInt());
+                    continue;
+                }
+                break;
+            default:
+                break;
             }
-            reader.raiseError(QLatin1String("Unexpected element ") + tag);
+            reader.raiseError(QLatin1String("Unexpected element ") + tag.toString());
         }
             break;
         case QXmlStreamReader::EndElement :
@@ -7662,32 +8166,48 @@ void DomDateTime::read(QXmlStreamReader &reader)
     for (bool finished = false; !finished && !reader.hasError();) {
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
-            const QString tag = reader.name().toString().toLower();
-            if (tag == QLatin1String("hour")) {
-                setElementHour(reader.readElementText().toInt());
-                continue;
-            }
-            if (tag == QLatin1String("minute")) {
-                setElementMinute(reader.readElementText().toInt());
-                continue;
-            }
-            if (tag == QLatin1String("second")) {
-                setElementSecond(reader.readElementText().toInt());
-                continue;
-            }
-            if (tag == QLatin1String("year")) {
-                setElementYear(reader.readElementText().toInt());
-                continue;
-            }
-            if (tag == QLatin1String("month")) {
-                setElementMonth(reader.readElementText().toInt());
-                continue;
-            }
-            if (tag == QLatin1String("day")) {
-                setElementDay(reader.readElementText().toInt());
-                continue;
+            const QStringRef tag = reader.name();
+            switch (tagHash(tag)) {
+            case 0x003aef1eu: // hour
+                if (tag.compare(QLatin1String("hour"), Qt::CaseInsensitive) == 0) {
+                    setElementHour(reader.readElementText().toInt());
+                    continue;
+                }
+                break;
+            case 0x05ecac32u: // minute
+                if (tag.compare(QLatin1String("minute"), Qt::CaseInsensitive) == 0) {
+                    setElementMinute(reader.readElementText().toInt());
+                    continue;
+                }
+                break;
+            case 0x139d1b7cu: // second
+                if (tag.compare(QLatin1String("second"), Qt::CaseInsensitive) == 0) {
+                    setElementSecond(reader.readElementText().toInt());
+                    continue;
+                }
+                break;
+            case 0x00441471u: // year
+                if (tag.compare(QLatin1String("year"), Qt::CaseInsensitive) == 0) {
+                    setElementYear(reader.readElementText().toInt());
+                    continue;
+                }
+                break;
+            case 0x07f33046u: // month
+                if (tag.compare(QLatin1String("month"), Qt::CaseInsensitive) == 0) {
+                    setElementMonth(reader.readElementText().toInt());
+                    continue;
+                }
+                break;
+            case 0x0001b65eu: // day
+                if (tag.compare(QLatin1String("day"), Qt::CaseInsensitive) == 0) {
+                    setElementDay(reader.readElementText().toInt());
+                    continue;
+                }
+                break;
+            default:
+                break;
             }
-            reader.raiseError(QLatin1String("Unexpected element ") + tag);
+            reader.raiseError(QLatin1String("Unexpected element ") + tag.toString());
         }
             break;
         case QXmlStreamReader::EndElement :
@@ -7871,12 +8391,18 @@ void DomStringList::read(QXmlStreamReader &reader)
     for (bool finished = false; !finished && !reader.hasError();) {
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
-            const QString tag = reader.name().toString().toLower();
-            if (tag == QLatin1String("string")) {
-                m_string.append(reader.readElementText());
-                continue;
+            const QStringRef tag = reader.name();
+            switch (tagHash(tag)) {
+            case 0x14b4ab37u: // string
+                if (tag.compare(QLatin1String("string"), Qt::CaseInsensitive) == 0) {
+                    m_string.append(reader.readElementText());
+                    continue;
+                }
+                break;
+            default:
+                break;
             }
-            reader.raiseError(QLatin1String("Unexpected element ") + tag);
+            reader.raiseError(QLatin1String("Unexpected element ") + tag.toString());
         }
             break;
         case QXmlStreamReader::EndElement :
@@ -7976,8 +8502,8 @@ void DomResourcePixmap::read(QXmlStreamReader &reader)
     for (bool finished = false; !finished && !reader.hasError();) {
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
-            const QString tag = reader.name().toString().toLower();
-            reader.raiseError(QLatin1String("Unexpected element ") + tag);
+            const QStringRef tag = reader.name();
+            reader.raiseError(QLatin1String("Unexpected element ") + tag.toString());
         }
             break;
         case QXmlStreamReader::EndElement :
@@ -8100,56 +8626,76 @@ void DomResourceIcon::read(QXmlStreamReader &reader)
     for (bool finished = false; !finished && !reader.hasError();) {
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
-            const QString tag = reader.name().toString().toLower();
-            if (tag == QLatin1String("normaloff")) {
-                DomResourcePixmap *v = new DomResourcePixmap();
-                v->read(reader);
-                setElementNormalOff(v);
-                continue;
-            }
-            if (tag == QLatin1String("normalon")) {
-                DomResourcePixmap *v = new DomResourcePixmap();
-                v->read(reader);
-                setElementNormalOn(v);
-                continue;
-            }
-            if (tag == QLatin1String("disabledoff")) {
-                DomResourcePixmap *v = new DomResourcePixmap();
-                v->read(reader);
-                setElementDisabledOff(v);
-                continue;
-            }
-            if (tag == QLatin1String("disabledon")) {
-                DomResourcePixmap *v = new DomResourcePixmap();
-                v->read(reader);
-                setElementDisabledOn(v);
-                continue;
-            }
-            if (tag == QLatin1String("activeoff")) {
-                DomResourcePixmap *v = new DomResourcePixmap();
-                v->read(reader);
-                setElementActiveOff(v);
-                continue;
-            }
-            if (tag == QLatin1String("activeon")) {
-                DomResourcePixmap *v = new DomResourcePixmap();
-                v->read(reader);
-                setElementActiveOn(v);
-                continue;
-            }
-            if (tag == QLatin1String("selectedoff")) {
-                DomResourcePixmap *v = new DomResourcePixmap();
-                v->read(reader);
-                setElementSelectedOff(v);
-                continue;
-            }
-            if (tag == QLatin1String("selectedon")) {
-                DomResourcePixmap *v = new DomResourcePixmap();
-                v->read(reader);
-                setElementSelectedOn(v);
-                continue;
+            const QStringRef tag = reader.name();
+            switch (tagHash(tag)) {
+            case 0xcacd9e04u: // normaloff
+                if (tag.compare(QLatin1String("normaloff"), Qt::CaseInsensitive) == 0) {
+                    DomResourcePixmap *v = new DomResourcePixmap();
+                    v->read(reader);
+                    setElementNormalOff(v);
+                    continue;
+                }
+                break;
+            case 0xf6a161e6u: // normalon
+                if (tag.compare(QLatin1String("normalon"), Qt::CaseInsensitive) == 0) {
+                    DomResourcePixmap *v = new DomResourcePixmap();
+                    v->read(reader);
+                    setElementNormalOn(v);
+                    continue;
+                }
+                break;
+            case 0x14798cf3u: // disabledoff
+                if (tag.compare(QLatin1String("disabledoff"), Qt::CaseInsensitive) == 0) {
+                    DomResourcePixmap *v = new DomResourcePixmap();
+                    v->read(reader);
+                    setElementDisabledOff(v);
+                    continue;
+                }
+                break;
+            case 0x9403aef5u: // disabledon
+                if (tag.compare(QLatin1String("disabledon"), Qt::CaseInsensitive) == 0) {
+                    DomResourcePixmap *v = new DomResourcePixmap();
+                    v->read(reader);
+                    setElementDisabledOn(v);
+                    continue;
+                }
+                break;
+            case 0x5f7de957u: // activeoff
+                if (tag.compare(QLatin1String("activeoff"), Qt::CaseInsensitive) == 0) {
+                    DomResourcePixmap *v = new DomResourcePixmap();
+                    v->read(reader);
+                    setElementActiveOff(v);
+                    continue;
+                }
+                break;
+            case 0x5ffc0ed9u: // activeon
+                if (tag.compare(QLatin1String("activeon"), Qt::CaseInsensitive) == 0) {
+                    DomResourcePixmap *v = new DomResourcePixmap();
+                    v->read(reader);
+                    setElementActiveOn(v);
+                    continue;
+                }
+                break;
+            case 0xb601a584u: // selectedoff
+                if (tag.compare(QLatin1String("selectedoff"), Qt::CaseInsensitive) == 0) {
+                    DomResourcePixmap *v = new DomResourcePixmap();
+                    v->read(reader);
+                    setElementSelectedOff(v);
+                    continue;
+                }
+                break;
+            case 0xbfb27966u: // selectedon
+                if (tag.compare(QLatin1String("selectedon"), Qt::CaseInsensitive) == 0) {
+                    DomResourcePixmap *v = new DomResourcePixmap();
+                    v->read(reader);
+                    setElementSelectedOn(v);
+                    continue;
+                }
+                break;
+            default:
+                break;
             }
-            reader.raiseError(QLatin1String("Unexpected element ") + tag);
+            reader.raiseError(QLatin1String("Unexpected element ") + tag.toString());
         }
             break;
         case QXmlStreamReader::EndElement :
@@ -8503,8 +9049,8 @@ void DomString::read(QXmlStreamReader &reader)
     for (bool finished = false; !finished && !reader.hasError();) {
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
-            const QString tag = reader.name().toString().toLower();
-            reader.raiseError(QLatin1String("Unexpected element ") + tag);
+            const QStringRef tag = reader.name();
+            reader.raiseError(QLatin1String("Unexpected element ") + tag.toString());
         }
             break;
         case QXmlStreamReader::EndElement :
@@ -8592,16 +9138,24 @@ void DomPointF::read(QXmlStreamReader &reader)
     for (bool finished = false; !finished && !reader.hasError();) {
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
-            const QString tag = reader.name().toString().toLower();
-            if (tag == QString(QLatin1Char('x'))) {
-                setElementX(reader.readElementText().toDouble());
-                continue;
-            }
-            if (tag == QString(QLatin1Char('y'))) {
-                setElementY(reader.readElementText().toDouble());
-                continue;
+            const QStringRef tag = reader.name();
+            switch (tagHash(tag)) {
+            case 0x00000078u: // x
+                if (tag.compare(QLatin1String("x"), Qt::CaseInsensitive) == 0) {
+                    setElementX(reader.readElementText().toDouble());
+                    continue;
+                }
+                break;
+            case 0x00000079u: // y
+                if (tag.compare(QLatin1String("y"), Qt::CaseInsensitive) == 0) {
+                    setElementY(reader.readElementText().toDouble());
+                    continue;
+                }
+                break;
+            default:
+                break;
             }
-            reader.raiseError(QLatin1String("Unexpected element ") + tag);
+            reader.raiseError(QLatin1String("Unexpected element ") + tag.toString());
         }
             break;
         case QXmlStreamReader::EndElement :
@@ -8715,24 +9269,36 @@ void DomRectF::read(QXmlStreamReader &reader)
     for (bool finished = false; !finished && !reader.hasError();) {
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
-            const QString tag = reader.name().toString().toLower();
-            if (tag == QString(QLatin1Char('x'))) {
-                setElementX(reader.readElementText().toDouble());
-                continue;
-            }
-            if (tag == QString(QLatin1Char('y'))) {
-                setElementY(reader.readElementText().toDouble());
-                continue;
-            }
-            if (tag == QLatin1String("width")) {
-                setElementWidth(reader.readElementText().toDouble());
-                continue;
-            }
-            if (tag == QLatin1String("height")) {
-                setElementHeight(reader.readElementText().toDouble());
-                continue;
+            const QStringRef tag = reader.name();
+            switch (tagHash(tag)) {
+            case 0x00000078u: // x
+                if (tag.compare(QLatin1String("x"), Qt::CaseInsensitive) == 0) {
+                    setElementX(reader.readElementText().toDouble());
+                    continue;
+                }
+                break;
+            case 0x00000079u: // y
+                if (tag.compare(QLatin1String("y"), Qt::CaseInsensitive) == 0) {
+                    setElementY(reader.readElementText().toDouble());
+                    continue;
+                }
+                break;
+            case 0x08a4b080u: // width
+                if (tag.compare(QLatin1String("width"), Qt::CaseInsensitive) == 0) {
+                    setElementWidth(reader.readElementText().toDouble());
+                    continue;
+                }
+                break;
+            case 0xf9f78419u: // height
+                if (tag.compare(QLatin1String("height"), Qt::CaseInsensitive) == 0) {
+                    setElementHeight(reader.readElementText().toDouble());
+                    continue;
+                }
+                break;
+            default:
+                break;
             }
-            reader.raiseError(QLatin1String("Unexpected element ") + tag);
+            reader.raiseError(QLatin1String("Unexpected element ") + tag.toString());
         }
             break;
         case QXmlStreamReader::EndElement :
@@ -8880,16 +9446,24 @@ void DomSizeF::read(QXmlStreamReader &reader)
     for (bool finished = false; !finished && !reader.hasError();) {
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
-            const QString tag = reader.name().toString().toLower();
-            if (tag == QLatin1String("width")) {
-                setElementWidth(reader.readElementText().toDouble());
-                continue;
-            }
-            if (tag == QLatin1String("height")) {
-                setElementHeight(reader.readElementText().toDouble());
-                continue;
+            const QStringRef tag = reader.name();
+            switch (tagHash(tag)) {
+            case 0x08a4b080u: // width
+                if (tag.compare(QLatin1String("width"), Qt::CaseInsensitive) == 0) {
+                    setElementWidth(reader.readElementText().toDouble());
+                    continue;
+                }
+                break;
+            case 0xf9f78419u: // height
+                if (tag.compare(QLatin1String("height"), Qt::CaseInsensitive) == 0) {
+                    setElementHeight(reader.readElementText().toDouble());
+                    continue;
+                }
+                break;
+            default:
+                break;
             }
-            reader.raiseError(QLatin1String("Unexpected element ") + tag);
+            reader.raiseError(QLatin1String("Unexpected element ") + tag.toString());
         }
             break;
         case QXmlStreamReader::EndElement :
@@ -8997,12 +9571,18 @@ void DomChar::read(QXmlStreamReader &reader)
     for (bool finished = false; !finished && !reader.hasError();) {
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
-            const QString tag = reader.name().toString().toLower();
-            if (tag == QLatin1String("unicode")) {
-                setElementUnicode(reader.readElementText().toInt());
-                continue;
+            const QStringRef tag = reader.name();
+            switch (tagHash(tag)) {
+            case 0x36997547u: // unicode
+                if (tag.compare(QLatin1String("unicode"), Qt::CaseInsensitive) == 0) {
+                    setElementUnicode(reader.readElementText().toInt());
+                    continue;
+                }
+                break;
+            default:
+                break;
             }
-            reader.raiseError(QLatin1String("Unexpected element ") + tag);
+            reader.raiseError(QLatin1String("Unexpected element ") + tag.toString());
         }
             break;
         case QXmlStreamReader::EndElement :
@@ -9093,14 +9673,20 @@ void DomUrl::read(QXmlStreamReader &reader)
     for (bool finished = false; !finished && !reader.hasError();) {
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
-            const QString tag = reader.name().toString().toLower();
-            if (tag == QLatin1String("string")) {
-                DomString *v = new DomString();
-                v->read(reader);
-                setElementString(v);
-                continue;
+            const QStringRef tag = reader.name();
+            switch (tagHash(tag)) {
+            case 0x14b4ab37u: // string
+                if (tag.compare(QLatin1String("string"), Qt::CaseInsensitive) == 0) {
+                    DomString *v = new DomString();
+                    v->read(reader);
+                    setElementString(v);
+                    continue;
+                }
+                break;
+            default:
+                break;
             }
-            reader.raiseError(QLatin1String("Unexpected element ") + tag);
+            reader.raiseError(QLatin1String("Unexpected element ") + tag.toString());
         }
             break;
         case QXmlStreamReader::EndElement :
@@ -9306,7 +9892,7 @@ void DomProperty::read(QXmlStreamReader &reader)
     foreach (const QXmlStreamAttribute &attribute, reader.attributes()) {
         QStringRef name = attribute.name();
         if (name == QLatin1String("name")) {
-            setAttributeName(attribute.value().toString());
+            setAttributeName(internString(attribute.value()));
             continue;
         }
         if (name == QLatin1String("stdset")) {
@@ -9319,182 +9905,252 @@ void DomProperty::read(QXmlStreamReader &reader)
     for (bool finished = false; !finished && !reader.hasError();) {
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
-            const QString tag = reader.name().toString().toLower();
-            if (tag == QLatin1String("bool")) {
-                setElementBool(reader.readElementText());
-                continue;
-            }
-            if (tag == QLatin1String("color")) {
-                DomColor *v = new DomColor();
-                v->read(reader);
-                setElementColor(v);
-                continue;
-            }
-            if (tag == QLatin1String("cstring")) {
-                setElementCstring(reader.readElementText());
-                continue;
-            }
-            if (tag == QLatin1String("cursor")) {
-                setElementCursor(reader.readElementText().toInt());
-                continue;
-            }
-            if (tag == QLatin1String("cursorshape")) {
-                setElementCursorShape(reader.readElementText());
-                continue;
-            }
-            if (tag == QLatin1String("enum")) {
-                setElementEnum(reader.readElementText());
-                continue;
-            }
-            if (tag == QLatin1String("font")) {
-                DomFont *v = new DomFont();
-                v->read(reader);
-                setElementFont(v);
-                continue;
-            }
-            if (tag == QLatin1String("iconset")) {
-                DomResourceIcon *v = new DomResourceIcon();
-                v->read(reader);
-                setElementIconSet(v);
-                continue;
-            }
-            if (tag == QLatin1String("pixmap")) {
-                DomResourcePixmap *v = new DomResourcePixmap();
-                v->read(reader);
-                setElementPixmap(v);
-                continue;
-            }
-            if (tag == QLatin1String("palette")) {
-                DomPalette *v = new DomPalette();
-                v->read(reader);
-                setElementPalette(v);
-                continue;
-            }
-            if (tag == QLatin1String("point")) {
-                DomPoint *v = new DomPoint();
-                v->read(reader);
-                setElementPoint(v);
-                continue;
-            }
-            if (tag == QLatin1String("rect")) {
-                DomRect *v = new DomRect();
-                v->read(reader);
-                setElementRect(v);
-                continue;
-            }
-            if (tag == QLatin1String("set")) {
-                setElementSet(reader.readElementText());
-                continue;
-            }
-            if (tag == QLatin1String("locale")) {
-                DomLocale *v = new DomLocale();
-                v->read(reader);
-                setElementLocale(v);
-                continue;
-            }
-            if (tag == QLatin1String("sizepolicy")) {
-                DomSizePolicy *v = new DomSizePolicy();
-                v->read(reader);
-                setElementSizePolicy(v);
-                continue;
-            }
-            if (tag == QLatin1String("size")) {
-                DomSize *v = new DomSize();
-                v->read(reader);
-                setElementSize(v);
-                continue;
-            }
-            if (tag == QLatin1String("string")) {
-                DomString *v = new DomString();
-                v->read(reader);
-                setElementString(v);
-                continue;
-            }
-            if (tag == QLatin1String("stringlist")) {
-                DomStringList *v = new DomStringList();
-                v->read(reader);
-                setElementStringList(v);
-                continue;
-            }
-            if (tag == QLatin1String("number")) {
-                setElementNumber(reader.readElementText().toInt());
-                continue;
-            }
-            if (tag == QLatin1String("float")) {
-                setElementFloat(reader.readElementText().toFloat());
-                continue;
-            }
-            if (tag == QLatin1String("double")) {
-                setElementDouble(reader.readElementText().toDouble());
-                continue;
-            }
-            if (tag == QLatin1String("date")) {
-                DomDate *v = new DomDate();
-                v->read(reader);
-                setElementDate(v);
-                continue;
-            }
-            if (tag == QLatin1String("time")) {
-                DomTime *v = new DomTime();
-                v->read(reader);
-                setElementTime(v);
-                continue;
-            }
-            if (tag == QLatin1String("datetime")) {
-                DomDateTime *v = new DomDateTime();
-                v->read(reader);
-                setElementDateTime(v);
-                continue;
-            }
-            if (tag == QLatin1String("pointf")) {
-                DomPointF *v = new DomPointF();
-                v->read(reader);
-                setElementPointF(v);
-                continue;
-            }
-            if (tag == QLatin1String("rectf")) {
-                DomRectF *v = new DomRectF();
-                v->read(reader);
-                setElementRectF(v);
-                continue;
-            }
-            if (tag == QLatin1String("sizef")) {
-                DomSizeF *v = new DomSizeF();
-                v->read(reader);
-                setElementSizeF(v);
-                continue;
-            }
-            if (tag == QLatin1String("longlong")) {
-                setElementLongLong(reader.readElementText().toLongLong());
-                continue;
-            }
-            if (tag == QLatin1String("char")) {
-                DomChar *v = new DomChar();
-                v->read(reader);
-                setElementChar(v);
-                continue;
-            }
-            if (tag == QLatin1String("url")) {
-                DomUrl *v = new DomUrl();
-                v->read(reader);
-                setElementUrl(v);
-                continue;
-            }
-            if (tag == QLatin1String("uint")) {
-                setElementUInt(reader.readElementText().toUInt());
-                continue;
-            }
-            if (tag == QLatin1String("ulonglong")) {
-                setElementULongLong(reader.readElementText().toULongLong());
-                continue;
-            }
-            if (tag == QLatin1String("brush")) {
-                DomBrush *v = new DomBrush();
-                v->read(reader);
-                setElementBrush(v);
-                continue;
+            const QStringRef tag = reader.name();
+            switch (tagHash(tag)) {
+            case 0x0037a40cu: // bool
+                if (tag.compare(QLatin1String("bool"), Qt::CaseInsensitive) == 0) {
+                    setElementBool(reader.readElementText());
+                    continue;
+                }
+                break;
+            case 0x073e321fu: // color
+                if (tag.compare(QLatin1String("color"), Qt::CaseInsensitive) == 0) {
+                    DomColor *v = new DomColor();
+                    v->read(reader);
+                    setElementColor(v);
+                    continue;
+                }
+                break;
+            case 0xd97a29dau: // cstring
+                if (tag.compare(QLatin1String("cstring"), Qt::CaseInsensitive) == 0) {
+                    setElementCstring(reader.readElementText());
+                    continue;
+                }
+                break;
+            case 0xef74645eu: // cursor
+                if (tag.compare(QLatin1String("cursor"), Qt::CaseInsensitive) == 0) {
+                    setElementCursor(reader.readElementText().toInt());
+                    continue;
+                }
+                break;
+            case 0xdf7383efu: // cursorshape
+                if (tag.compare(QLatin1String("cursorshape"), Qt::CaseInsensitive) == 0) {
+                    setElementCursorShape(reader.readElementText());
+                    continue;
+                }
+                break;
+            case 0x003945b5u: // enum
+                if (tag.compare(QLatin1String("enum"), Qt::CaseInsensitive) == 0) {
+                    setElementEnum(reader.readElementText());
+                    continue;
+                }
+                break;
+            case 0x0039d577u: // font
+                if (tag.compare(QLatin1String("font"), Qt::CaseInsensitive) == 0) {
+                    DomFont *v = new DomFont();
+                    v->read(reader);
+                    setElementFont(v);
+                    continue;
+                }
+                break;
+            case 0x81a889b5u: // iconset
+                if (tag.compare(QLatin1String("iconset"), Qt::CaseInsensitive) == 0) {
+                    DomResourceIcon *v = new DomResourceIcon();
+                    v->read(reader);
+                    setElementIconSet(v);
+                    continue;
+                }
+                break;
+            case 0x0cf17d6fu: // pixmap
+                if (tag.compare(QLatin1String("pixmap"), Qt::CaseInsensitive) == 0) {
+                    DomResourcePixmap *v = new DomResourcePixmap();
+                    v->read(reader);
+                    setElementPixmap(v);
+                    continue;
+                }
+                break;
+            case 0x979aaeefu: // palette
+                if (tag.compare(QLatin1String("palette"), Qt::CaseInsensitive) == 0) {
+                    DomPalette *v = new DomPalette();
+                    v->read(reader);
+                    setElementPalette(v);
+                    continue;
+                }
+                break;
+            case 0x082963cau: // point
+                if (tag.compare(QLatin1String("point"), Qt::CaseInsensitive) == 0) {
+                    DomPoint *v = new DomPoint();
+                    v->read(reader);
+                    setElementPoint(v);
+                    continue;
+                }
+                break;
+            case 0x00403e0eu: // rect
+                if (tag.compare(QLatin1String("rect"), Qt::CaseInsensitive) == 0) {
+                    DomRect *v = new DomRect();
+                    v->read(reader);
+                    setElementRect(v);
+                    continue;
+                }
+                break;
+            case 0x0001f6acu: // set
+                if (tag.compare(QLatin1String("set"), Qt::CaseInsensitive) == 0) {
+                    setElementSet(reader.readElementText());
+                    continue;
+                }
+                break;
+            case 0x03fdb850u: // locale
+                if (tag.compare(QLatin1String("locale"), Qt::CaseInsensitive) == 0) {
+                    DomLocale *v = new DomLocale();
+                    v->read(reader);
+                    setElementLocale(v);
+                    continue;
+                }
+                break;
+            case 0x9b3a61cbu: // sizepolicy
+                if (tag.compare(QLatin1String("sizepolicy"), Qt::CaseInsensitive) == 0) {
+                    DomSizePolicy *v = new DomSizePolicy();
+                    v->read(reader);
+                    setElementSizePolicy(v);
+                    continue;
+                }
+                break;
+            case 0x0040de5bu: // size
+                if (tag.compare(QLatin1String("size"), Qt::CaseInsensitive) == 0) {
+                    DomSize *v = new DomSize();
+                    v->read(reader);
+                    setElementSize(v);
+                    continue;
+                }
+                break;
+            case 0x14b4ab37u: // string
+                if (tag.compare(QLatin1String("string"), Qt::CaseInsensitive) == 0) {
+                    DomString *v = new DomString();
+                    v->read(reader);
+                    setElementString(v);
+                    continue;
+                }
+                break;
+            case 0x69327593u: // stringlist
+                if (tag.compare(QLatin1String("stringlist"), Qt::CaseInsensitive) == 0) {
+                    DomStringList *v = new DomStringList();
+                    v->read(reader);
+                    setElementStringList(v);
+                    continue;
+                }
+                break;
+            case 0x091a1bc9u: // number
+                if (tag.compare(QLatin1String("number"), Qt::CaseInsensitive) == 0) {
+                    setElementNumber(reader.readElementText().toInt());
+                    continue;
+                }
+                break;
+            case 0x0772e176u: // float
+                if (tag.compare(QLatin1String("float"), Qt::CaseInsensitive) == 0) {
+                    setElementFloat(reader.readElementText().toFloat());
+                    continue;
+                }
+                break;
+            case 0xf15e565bu: // double
+                if (tag.compare(QLatin1String("double"), Qt::CaseInsensitive) == 0) {
+                    setElementDouble(reader.readElementText().toDouble());
+                    continue;
+                }
+                break;
+            case 0x003881deu: // date
+                if (tag.compare(QLatin1String("date"), Qt::CaseInsensitive) == 0) {
+                    DomDate *v = new DomDate();
+                    v->read(reader);
+                    setElementDate(v);
+                    continue;
+                }
+                break;
+            case 0x0041690fu: // time
+                if (tag.compare(QLatin1String("time"), Qt::CaseInsensitive) == 0) {
+                    DomTime *v = new DomTime();
+                    v->read(reader);
+                    setElementTime(v);
+                    continue;
+                }
+                break;
+            case 0x8a83a9edu: // datetime
+                if (tag.compare(QLatin1String("datetime"), Qt::CaseInsensitive) == 0) {
+                    DomDateTime *v = new DomDateTime();
+                    v->read(reader);
+                    setElementDateTime(v);
+                    continue;
+                }
+                break;
+            case 0x0d55dd70u: // pointf
+                if (tag.compare(QLatin1String("pointf"), Qt::CaseInsensitive) == 0) {
+                    DomPointF *v = new DomPointF();
+                    v->read(reader);
+                    setElementPointF(v);
+                    continue;
+                }
+                break;
+            case 0x08480034u: // rectf
+                if (tag.compare(QLatin1String("rectf"), Qt::CaseInsensitive) == 0) {
+                    DomRectF *v = new DomRectF();
+                    v->read(reader);
+                    setElementRectF(v);
+                    continue;
+                }
+                break;
+            case 0x085caa21u: // sizef
+                if (tag.compare(QLatin1String("sizef"), Qt::CaseInsensitive) == 0) {
+                    DomSizeF *v = new DomSizeF();
+                    v->read(reader);
+                    setElementSizeF(v);
+                    continue;
+                }
+                break;
+            case 0x14629760u: // longlong
+                if (tag.compare(QLatin1String("longlong"), Qt::CaseInsensitive) == 0) {
+                    setElementLongLong(reader.readElementText().toLongLong());
+                    continue;
+                }
+                break;
+            case 0x003810deu: // char
+                if (tag.compare(QLatin1String("char"), Qt::CaseInsensitive) == 0) {
+                    DomChar *v = new DomChar();
+                    v->read(reader);
+                    setElementChar(v);
+                    continue;
+                }
+                break;
+            case 0x000200d3u: // url
+                if (tag.compare(QLatin1String("url"), Qt::CaseInsensitive) == 0) {
+                    DomUrl *v = new DomUrl();
+                    v->read(reader);
+                    setElementUrl(v);
+                    continue;
+                }
+                break;
+            case 0x0041f5a0u: // uint
+                if (tag.compare(QLatin1String("uint"), Qt::CaseInsensitive) == 0) {
+                    setElementUInt(reader.readElementText().toUInt());
+                    continue;
+                }
+                break;
+            case 0x51423cd5u: // ulonglong
+                if (tag.compare(QLatin1String("ulonglong"), Qt::CaseInsensitive) == 0) {
+                    setElementULongLong(reader.readElementText().toULongLong());
+                    continue;
+                }
+                break;
+            case 0x072de584u: // brush
+                if (tag.compare(QLatin1String("brush"), Qt::CaseInsensitive) == 0) {
+                    DomBrush *v = new DomBrush();
+                    v->read(reader);
+                    setElementBrush(v);
+                    continue;
+                }
+                break;
+            default:
+                break;
             }
-            reader.raiseError(QLatin1String("Unexpected element ") + tag);
+            reader.raiseError(QLatin1String("Unexpected element ") + tag.toString());
         }
             break;
         case QXmlStreamReader::EndElement :
@@ -10328,14 +10984,20 @@ void DomConnections::read(QXmlStreamReader &reader)
     for (bool finished = false; !finished && !reader.hasError();) {
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
-            const QString tag = reader.name().toString().toLower();
-            if (tag == QLatin1String("connection")) {
-                DomConnection *v = new DomConnection();
-                v->read(reader);
-                m_connection.append(v);
-                continue;
+            const QStringRef tag = reader.name();
+            switch (tagHash(tag)) {
+            case 0x9cb49d90u: // connection
+                if (tag.compare(QLatin1String("connection"), Qt::CaseInsensitive) == 0) {
+                    DomConnection *v = new DomConnection();
+                    v->read(reader);
+                    m_connection.append(v);
+                    continue;
+                }
+                break;
+            default:
+                break;
             }
-            reader.raiseError(QLatin1String("Unexpected element ") + tag);
+            reader.raiseError(QLatin1String("Unexpected element ") + tag.toString());
         }
             break;
         case QXmlStreamReader::EndElement :
@@ -10423,30 +11085,44 @@ void DomConnection::read(QXmlStreamReader &reader)
     for (bool finished = false; !finished && !reader.hasError();) {
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
-            const QString tag = reader.name().toString().toLower();
-            if (tag == QLatin1String("sender")) {
-                setElementSender(reader.readElementText());
-                continue;
-            }
-            if (tag == QLatin1String("signal")) {
-                setElementSignal(reader.readElementText());
-                continue;
-            }
-            if (tag == QLatin1String("receiver")) {
-                setElementReceiver(reader.readElementText());
-                continue;
-            }
-            if (tag == QLatin1String("slot")) {
-                setElementSlot(reader.readElementText());
-                continue;
-            }
-            if (tag == QLatin1String("hints")) {
-                DomConnectionHints *v = new DomConnectionHints();
-                v->read(reader);
-                setElementHints(v);
-                continue;
+            const QStringRef tag = reader.name();
+            switch (tagHash(tag)) {
+            case 0x13a2f3c1u: // sender
+                if (tag.compare(QLatin1String("sender"), Qt::CaseInsensitive) == 0) {
+                    setElementSender(reader.readElementText());
+                    continue;
+                }
+                break;
+            case 0x13e7a91eu: // signal
+                if (tag.compare(QLatin1String("signal"), Qt::CaseInsensitive) == 0) {
+                    setElementSignal(reader.readElementText());
+                    continue;
+                }
+                break;
+            case 0x8258bcb5u: // receiver
+                if (tag.compare(QLatin1String("receiver"), Qt::CaseInsensitive) == 0) {
+                    setElementReceiver(reader.readElementText());
+                    continue;
+                }
+                break;
+            case 0x0040e9c2u: // slot
+                if (tag.compare(QLatin1String("slot"), Qt::CaseInsensitive) == 0) {
+                    setElementSlot(reader.readElementText());
+                    continue;
+                }
+                break;
+            case 0x07956b86u: // hints
+                if (tag.compare(QLatin1String("hints"), Qt::CaseInsensitive) == 0) {
+                    DomConnectionHints *v = new DomConnectionHints();
+                    v->read(reader);
+                    setElementHints(v);
+                    continue;
+                }
+                break;
+            default:
+                break;
             }
-            reader.raiseError(QLatin1String("Unexpected element ") + tag);
+            reader.raiseError(QLatin1String("Unexpected element ") + tag.toString());
         }
             break;
         case QXmlStreamReader::EndElement :
@@ -10626,14 +11302,20 @@ void DomConnectionHints::read(QXmlStreamReader &reader)
     for (bool finished = false; !finished && !reader.hasError();) {
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
-            const QString tag = reader.name().toString().toLower();
-            if (tag == QLatin1String("hint")) {
-                DomConnectionHint *v = new DomConnectionHint();
-                v->read(reader);
-                m_hint.append(v);
-                continue;
+            const QStringRef tag = reader.name();
+            switch (tagHash(tag)) {
+            case 0x003ad4b3u: // hint
+                if (tag.compare(QLatin1String("hint"), Qt::CaseInsensitive) == 0) {
+                    DomConnectionHint *v = new DomConnectionHint();
+                    v->read(reader);
+                    m_hint.append(v);
+                    continue;
+                }
+                break;
+            default:
+                break;
             }
-            reader.raiseError(QLatin1String("Unexpected element ") + tag);
+            reader.raiseError(QLatin1String("Unexpected element ") + tag.toString());
         }
             break;
         case QXmlStreamReader::EndElement :
@@ -10732,16 +11414,24 @@ void DomConnectionHint::read(QXmlStreamReader &reader)
     for (bool finished = false; !finished && !reader.hasError();) {
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
-            const QString tag = reader.name().toString().toLower();
-            if (tag == QString(QLatin1Char('x'))) {
-                setElementX(reader.readElementText().toInt());
-                continue;
-            }
-            if (tag == QString(QLatin1Char('y'))) {
-                setElementY(reader.readElementText().toInt());
-                continue;
+            const QStringRef tag = reader.name();
+            switch (tagHash(tag)) {
+            case 0x00000078u: // x
+                if (tag.compare(QLatin1String("x"), Qt::CaseInsensitive) == 0) {
+                    setElementX(reader.readElementText().toInt());
+                    continue;
+                }
+                break;
+            case 0x00000079u: // y
+                if (tag.compare(QLatin1String("y"), Qt::CaseInsensitive) == 0) {
+                    setElementY(reader.readElementText().toInt());
+                    continue;
+                }
+                break;
+            default:
+                break;
             }
-            reader.raiseError(QLatin1String("Unexpected element ") + tag);
+            reader.raiseError(QLatin1String("Unexpected element ") + tag.toString());
         }
             break;
         case QXmlStreamReader::EndElement :
@@ -10861,16 +11551,23 @@ void DomTriggers::read( QXmlStreamReader &reader )
         {
             case QXmlStreamReader::StartElement :
             {
-                const QString tag = reader.name().toString().toLower();
-                if ( tag == QLatin1String( "trigger" ) )
+                const QStringRef tag = reader.name();
+                switch ( tagHash( tag ) )
                 {
-                    DomTrigger *v = new DomTrigger();
-                    v->read( reader );
-                    m_trigger.append( v );
-                    continue;
+                    case 0xf2f5eab4u : // trigger
+                        if ( tag.compare( QLatin1String( "trigger" ), Qt::CaseInsensitive ) == 0 )
+                        {
+                            DomTrigger *v = new DomTrigger();
+                            v->read( reader );
+                            m_trigger.append( v );
+                            continue;
+                        }
+                        break;
+                    default :
+                        break;
                 }
 
-                reader.raiseError( QLatin1String( "Unexpected element " ) + tag );
+                reader.raiseError( QLatin1String( "Unexpected element " ) + tag.toString() );
             } break;
 
         case QXmlStreamReader::EndElement :
@@ -10954,6 +11651,10 @@ void DomTrigger::clear( bool clear_all )
 DomTrigger::DomTrigger()
 {
     m_children = 0;
+    m_has_attr_object = false;
+    m_has_attr_class = false;
+    m_has_attr_match = false;
+    m_has_attr_property = false;
 }
 
 DomTrigger::~DomTrigger()
@@ -10973,25 +11674,50 @@ void DomTrigger::read( QXmlStreamReader &reader )
             continue;
         }
 
-        reader.raiseError( QLatin1String( "Unexpected attribute " ) + name.toString() );
-    }
-
-    for ( bool finished = false; !finished && !reader.hasError(); )
-    {
-        switch ( reader.readNext() )
+        if ( name == QLatin1String( "class" ) )
+        {
+            setAttributeClass( attribute.value().toString() );
+            continue;
+        }
+
+        if ( name == QLatin1String( "match" ) )
+        {
+            setAttributeMatch( attribute.value().toString() );
+            continue;
+        }
+
+        if ( name == QLatin1String( "property" ) )
+        {
+            setAttributeProperty( attribute.value().toString() );
+            continue;
+        }
+
+        reader.raiseError( QLatin1String( "Unexpected attribute " ) + name.toString() );
+    }
+
+    for ( bool finished = false; !finished && !reader.hasError(); )
+    {
+        switch ( reader.readNext() )
         {
             case QXmlStreamReader::StartElement :
             {
-                const QString tag = reader.name().toString().toLower();
-                if ( tag == QLatin1String( "event" ) )
+                const QStringRef tag = reader.name();
+                switch ( tagHash( tag ) )
                 {
-                    DomEvent *v = new DomEvent();
-                    v->read( reader );
-                    m_event.append( v );
-                    continue;
+                    case 0x07661be2u : // event
+                        if ( tag.compare( QLatin1String( "event" ), Qt::CaseInsensitive ) == 0 )
+                        {
+                            DomEvent *v = new DomEvent();
+                            v->read( reader );
+                            m_event.append( v );
+                            continue;
+                        }
+                        break;
+                    default :
+                        break;
                 }
 
-                reader.raiseError( QLatin1String( "Unexpected element " ) + tag );
+                reader.raiseError( QLatin1String( "Unexpected element " ) + tag.toString() );
             }
             break;
 
@@ -11015,6 +11741,12 @@ void DomTrigger::read( const QDomElement &node )
 {
     if ( node.hasAttribute( QLatin1String( "object" ) ) )
         setAttributeObject( node.attribute( QLatin1String( "object" ) ) );
+    if ( node.hasAttribute( QLatin1String( "class" ) ) )
+        setAttributeClass( node.attribute( QLatin1String( "class" ) ) );
+    if ( node.hasAttribute( QLatin1String( "match" ) ) )
+        setAttributeMatch( node.attribute( QLatin1String( "match" ) ) );
+    if ( node.hasAttribute( QLatin1String( "property" ) ) )
+        setAttributeProperty( node.attribute( QLatin1String( "property" ) ) );
 
     for ( QDomNode n = node.firstChild(); !n.isNull(); n = n.nextSibling() )
     {
@@ -11049,6 +11781,15 @@ void DomTrigger::write( QXmlStreamWriter &writer, const QString &tagName ) const
     if ( hasAttributeObject() )
         writer.writeAttribute( QLatin1String( "object" ), attributeObject() );
 
+    if ( hasAttributeClass() )
+        writer.writeAttribute( QLatin1String( "class" ), attributeClass() );
+
+    if ( hasAttributeMatch() )
+        writer.writeAttribute( QLatin1String( "match" ), attributeMatch() );
+
+    if ( hasAttributeProperty() )
+        writer.writeAttribute( QLatin1String( "property" ), attributeProperty() );
+
     for ( int i = 0; i < m_event.size(); ++i )
     {
         DomEvent *v = m_event[i];
@@ -11074,8 +11815,15 @@ void DomEvent::clear( bool clear_all )
         m_text = QLatin1String( "" );
         m_has_attr_signal = false;
         m_has_attr_action = false;
+        m_has_attr_input = false;
+        m_has_attr_widgets = false;
+        m_has_attr_apply = false;
+        m_has_attr_shell = false;
     }
 
+    m_command.clear();
+    qDeleteAll( m_pipeline );
+    m_pipeline.clear();
     m_children = 0;
 }
 
@@ -11084,11 +11832,17 @@ DomEvent::DomEvent()
     m_children = 0;
     m_has_attr_signal = false;
     m_has_attr_action = false;
+    m_has_attr_input = false;
+    m_has_attr_widgets = false;
+    m_has_attr_apply = false;
+    m_has_attr_shell = false;
     m_text = QLatin1String( "" );
 }
 
 DomEvent::~DomEvent()
 {
+    qDeleteAll( m_pipeline );
+    m_pipeline.clear();
 }
 
 void DomEvent::read( QXmlStreamReader &reader )
@@ -11106,6 +11860,26 @@ void DomEvent::read( QXmlStreamReader &reader )
             setAttributeAction( attribute.value().toString() );
             continue;
         }
+        else if ( name == QLatin1String( "input" ) )
+        {
+            setAttributeInput( attribute.value().toString() );
+            continue;
+        }
+        else if ( name == QLatin1String( "widgets" ) )
+        {
+            setAttributeWidgets( attribute.value().toString() );
+            continue;
+        }
+        else if ( name == QLatin1String( "apply" ) )
+        {
+            setAttributeApply( attribute.value().toString() );
+            continue;
+        }
+        else if ( name == QLatin1String( "shell" ) )
+        {
+            setAttributeShell( attribute.value().toString() );
+            continue;
+        }
 
         reader.raiseError( QLatin1String( "Unexpected attribute " ) + name.toString() );
     }
@@ -11116,8 +11890,32 @@ void DomEvent::read( QXmlStreamReader &reader )
         {
             case QXmlStreamReader::StartElement :
             {
-                const QString tag = reader.name().toString().toLower();
-                reader.raiseError( QLatin1String( "Unexpected element " ) + tag );
+                const QStringRef tag = reader.name();
+                switch ( tagHash( tag ) )
+                {
+                    case 0xcfa3fbdfu : // command
+                        if ( tag.compare( QLatin1String( "command" ), Qt::CaseInsensitive ) == 0 )
+                        {
+                            m_command.append( reader.readElementText() );
+                            m_children |= Command;
+                            continue;
+                        }
+                        break;
+                    case 0xfc128516u : // pipeline
+                        if ( tag.compare( QLatin1String( "pipeline" ), Qt::CaseInsensitive ) == 0 )
+                        {
+                            DomPipeline *v = new DomPipeline();
+                            v->read( reader );
+                            m_pipeline.append( v );
+                            m_children |= Pipeline;
+                            continue;
+                        }
+                        break;
+                    default :
+                        break;
+                }
+
+                reader.raiseError( QLatin1String( "Unexpected element " ) + tag.toString() );
             }
             break;
 
@@ -11145,12 +11943,40 @@ void DomEvent::read( const QDomElement &node )
     if (node.hasAttribute( QLatin1String( "action" ) ) )
         setAttributeAction( node.attribute( QLatin1String( "action" ) ) );
 
+    if (node.hasAttribute( QLatin1String( "input" ) ) )
+        setAttributeInput( node.attribute( QLatin1String( "input" ) ) );
+
+    if (node.hasAttribute( QLatin1String( "widgets" ) ) )
+        setAttributeWidgets( node.attribute( QLatin1String( "widgets" ) ) );
+
+    if (node.hasAttribute( QLatin1String( "apply" ) ) )
+        setAttributeApply( node.attribute( QLatin1String( "apply" ) ) );
+
+    if (node.hasAttribute( QLatin1String( "shell" ) ) )
+        setAttributeShell( node.attribute( QLatin1String( "shell" ) ) );
+
     for ( QDomNode n = node.firstChild(); !n.isNull(); n = n.nextSibling() )
     {
         if ( !n.isElement() )
             continue;
         QDomElement e = n.toElement();
         QString tag = e.tagName().toLower();
+
+        if ( tag == QLatin1String( "command" ) )
+        {
+            m_command.append( e.text() );
+            m_children |= Command;
+            continue;
+        }
+
+        if ( tag == QLatin1String( "pipeline" ) )
+        {
+            DomPipeline *v = new DomPipeline();
+            v->read( e );
+            m_pipeline.append( v );
+            m_children |= Pipeline;
+            continue;
+        }
     }
 
     m_text = QLatin1String( "" );
@@ -11172,11 +11998,343 @@ void DomEvent::write( QXmlStreamWriter &writer, const QString &tagName ) const
     if ( hasAttributeAction() )
         writer.writeAttribute( QLatin1String( "action" ), attributeAction() );
 
+    if ( hasAttributeInput() )
+        writer.writeAttribute( QLatin1String( "input" ), attributeInput() );
+
+    if ( hasAttributeWidgets() )
+        writer.writeAttribute( QLatin1String( "widgets" ), attributeWidgets() );
+
+    if ( hasAttributeApply() )
+        writer.writeAttribute( QLatin1String( "apply" ), attributeApply() );
+
+    if ( hasAttributeShell() )
+        writer.writeAttribute( QLatin1String( "shell" ), attributeShell() );
+
+    for ( int i = 0; i < m_command.size(); ++i )
+    {
+        writer.writeTextElement( QLatin1String( "command" ), m_command.at( i ) );
+    }
+
+    for ( int i = 0; i < m_pipeline.size(); ++i )
+    {
+        m_pipeline[i]->write( writer, QLatin1String( "pipeline" ) );
+    }
+
+    if ( !m_text.isEmpty() )
+        writer.writeCharacters( m_text );
+
+    writer.writeEndElement();
+}
+
+void DomEvent::setElementCommand( const QStringList &a )
+{
+    m_children |= Command;
+    m_command = a;
+}
+
+void DomEvent::setElementPipeline( const QList< DomPipeline* > &a )
+{
+    m_children |= Pipeline;
+    m_pipeline = a;
+}
+
+void DomSelect::clear( bool clear_all )
+{
+    qDeleteAll( m_property );
+    m_property.clear();
+
+    if ( clear_all )
+    {
+        m_text.clear();
+        m_has_attr_class = false;
+        m_has_attr_match = false;
+        m_has_attr_parent = false;
+        m_has_attr_property = false;
+    }
+
+    m_children = 0;
+}
+
+DomSelect::DomSelect()
+{
+    m_children = 0;
+    m_has_attr_class = false;
+    m_has_attr_match = false;
+    m_has_attr_parent = false;
+    m_has_attr_property = false;
+}
+
+DomSelect::~DomSelect()
+{
+    qDeleteAll( m_property );
+    m_property.clear();
+}
+
+void DomSelect::read( QXmlStreamReader &reader )
+{
+    foreach ( const QXmlStreamAttribute &attribute, reader.attributes() )
+    {
+        QStringRef name = attribute.name();
+        if ( name == QLatin1String( "class" ) )
+        {
+            setAttributeClass( attribute.value().toString() );
+            continue;
+        }
+
+        if ( name == QLatin1String( "match" ) )
+        {
+            setAttributeMatch( attribute.value().toString() );
+            continue;
+        }
+
+        if ( name == QLatin1String( "parent" ) )
+        {
+            setAttributeParent( attribute.value().toString() );
+            continue;
+        }
+
+        if ( name == QLatin1String( "property" ) )
+        {
+            setAttributeProperty( attribute.value().toString() );
+            continue;
+        }
+
+        reader.raiseError( QLatin1String( "Unexpected attribute " ) + name.toString() );
+    }
+
+    for ( bool finished = false; !finished && !reader.hasError(); )
+    {
+        switch ( reader.readNext() )
+        {
+            case QXmlStreamReader::StartElement :
+            {
+                const QStringRef tag = reader.name();
+                switch ( tagHash( tag ) )
+                {
+                    case 0xaf4cdd45u : // property
+                        if ( tag.compare( QLatin1String( "property" ), Qt::CaseInsensitive ) == 0 )
+                        {
+                            DomProperty *v = new DomProperty();
+                            v->read( reader );
+                            m_property.append( v );
+                            m_children |= Property;
+                            continue;
+                        }
+                        break;
+                    default :
+                        break;
+                }
+
+                reader.raiseError( QLatin1String( "Unexpected element " ) + tag.toString() );
+            }
+            break;
+
+        case QXmlStreamReader::EndElement :
+            finished = true;
+            break;
+
+        case QXmlStreamReader::Characters :
+            if ( !reader.isWhitespace() )
+                m_text.append( reader.text().toString() );
+            break;
+
+        default :
+            break;
+        }
+    }
+}
+
+#ifdef QUILOADER_QDOM_READ
+void DomSelect::read( const QDomElement &node )
+{
+    if ( node.hasAttribute( QLatin1String( "class" ) ) )
+        setAttributeClass( node.attribute( QLatin1String( "class" ) ) );
+    if ( node.hasAttribute( QLatin1String( "match" ) ) )
+        setAttributeMatch( node.attribute( QLatin1String( "match" ) ) );
+    if ( node.hasAttribute( QLatin1String( "parent" ) ) )
+        setAttributeParent( node.attribute( QLatin1String( "parent" ) ) );
+    if ( node.hasAttribute( QLatin1String( "property" ) ) )
+        setAttributeProperty( node.attribute( QLatin1String( "property" ) ) );
+
+    for ( QDomNode n = node.firstChild(); !n.isNull(); n = n.nextSibling() )
+    {
+        if ( !n.isElement() )
+            continue;
+
+        QDomElement e = n.toElement();
+        QString tag = e.tagName().toLower();
+
+        if ( tag == QLatin1String( "property" ) )
+        {
+            DomProperty *v = new DomProperty();
+            v->read( e );
+            m_property.append( v );
+            m_children |= Property;
+            continue;
+        }
+    }
+
+    m_text.clear();
+    for ( QDomNode child = node.firstChild(); !child.isNull(); child = child.nextSibling() )
+    {
+        if ( child.isText() )
+            m_text.append( child.nodeValue() );
+    }
+}
+#endif
+
+void DomSelect::write( QXmlStreamWriter &writer, const QString &tagName ) const
+{
+    writer.writeStartElement( tagName.isEmpty() ? QString::fromUtf8( "select" ) : tagName.toLower() );
+
+    if ( hasAttributeClass() )
+        writer.writeAttribute( QLatin1String( "class" ), attributeClass() );
+
+    if ( hasAttributeMatch() )
+        writer.writeAttribute( QLatin1String( "match" ), attributeMatch() );
+
+    if ( hasAttributeParent() )
+        writer.writeAttribute( QLatin1String( "parent" ), attributeParent() );
+
+    if ( hasAttributeProperty() )
+        writer.writeAttribute( QLatin1String( "property" ), attributeProperty() );
+
+    for ( int i = 0; i < m_property.size(); ++i )
+    {
+        DomProperty *v = m_property[i];
+        v->write( writer, QLatin1String( "property" ) );
+    }
+
     if ( !m_text.isEmpty() )
         writer.writeCharacters( m_text );
 
     writer.writeEndElement();
 }
+
+void DomSelect::setElementProperty( const QList< DomProperty* > &a )
+{
+    m_children |= Property;
+    m_property = a;
+}
+
+void DomPipeline::clear( bool clear_all )
+{
+    m_stage.clear();
+
+    if ( clear_all )
+    {
+        m_text.clear();
+    }
+
+    m_children = 0;
+}
+
+DomPipeline::DomPipeline()
+{
+    m_children = 0;
+}
+
+DomPipeline::~DomPipeline()
+{
+    m_stage.clear();
+}
+
+void DomPipeline::read( QXmlStreamReader &reader )
+{
+    foreach ( const QXmlStreamAttribute &attribute, reader.attributes() )
+    {
+        QStringRef name = attribute.name();
+        reader.raiseError( QLatin1String( "Unexpected attribute " ) + name.toString() );
+    }
+
+    for ( bool finished = false; !finished && !reader.hasError(); )
+    {
+        switch ( reader.readNext() )
+        {
+            case QXmlStreamReader::StartElement :
+            {
+                const QStringRef tag = reader.name();
+                switch ( tagHash( tag ) )
+                {
+                    case 0x08624834u : // stage
+                        if ( tag.compare( QLatin1String( "stage" ), Qt::CaseInsensitive ) == 0 )
+                        {
+                            m_stage.append( reader.readElementText() );
+                            m_children |= Stage;
+                            continue;
+                        }
+                        break;
+                    default :
+                        break;
+                }
+
+                reader.raiseError( QLatin1String( "Unexpected element " ) + tag.toString() );
+            }
+            break;
+
+        case QXmlStreamReader::EndElement :
+            finished = true;
+            break;
+
+        case QXmlStreamReader::Characters :
+            if ( !reader.isWhitespace() )
+                m_text.append( reader.text().toString() );
+            break;
+
+        default :
+            break;
+        }
+    }
+}
+
+#ifdef QUILOADER_QDOM_READ
+void DomPipeline::read( const QDomElement &node )
+{
+    for ( QDomNode n = node.firstChild(); !n.isNull(); n = n.nextSibling() )
+    {
+        if ( !n.isElement() )
+            continue;
+
+        QDomElement e = n.toElement();
+        QString tag = e.tagName().toLower();
+
+        if ( tag == QLatin1String( "stage" ) )
+        {
+            m_stage.append( e.text() );
+            m_children |= Stage;
+            continue;
+        }
+    }
+
+    m_text.clear();
+    for ( QDomNode child = node.firstChild(); !child.isNull(); child = child.nextSibling() )
+    {
+        if ( child.isText() )
+            m_text.append( child.nodeValue() );
+    }
+}
+#endif
+
+void DomPipeline::write( QXmlStreamWriter &writer, const QString &tagName ) const
+{
+    writer.writeStartElement( tagName.isEmpty() ? QString::fromUtf8( "pipeline" ) : tagName.toLower() );
+
+    for ( int i = 0; i < m_stage.size(); ++i )
+    {
+        writer.writeTextElement( QLatin1String( "stage" ), m_stage.at( i ) );
+    }
+
+    if ( !m_text.isEmpty() )
+        writer.writeCharacters( m_text );
+
+    writer.writeEndElement();
+}
+
+void DomPipeline::setElementStage( const QStringList &a )
+{
+    m_children |= Stage;
+    m_stage = a;
+}
 // END: Val
 
 void DomScript::clear(bool clear_all)
@@ -11221,8 +12379,8 @@ void DomScript::read(QXmlStreamReader &reader)
     for (bool finished = false; !finished && !reader.hasError();) {
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
-            const QString tag = reader.name().toString().toLower();
-            reader.raiseError(QLatin1String("Unexpected element ") + tag);
+            const QStringRef tag = reader.name();
+            reader.raiseError(QLatin1String("Unexpected element ") + tag.toString());
         }
             break;
         case QXmlStreamReader::EndElement :
@@ -11305,14 +12463,20 @@ void DomWidgetData::read(QXmlStreamReader &reader)
     for (bool finished = false; !finished && !reader.hasError();) {
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
-            const QString tag = reader.name().toString().toLower();
-            if (tag == QLatin1String("property")) {
-                DomProperty *v = new DomProperty();
-                v->read(reader);
-                m_property.append(v);
-                continue;
+            const QStringRef tag = reader.name();
+            switch (tagHash(tag)) {
+            case 0xaf4cdd45u: // property
+                if (tag.compare(QLatin1String("property"), Qt::CaseInsensitive) == 0) {
+                    DomProperty *v = new DomProperty();
+                    v->read(reader);
+                    m_property.append(v);
+                    continue;
+                }
+                break;
+            default:
+                break;
             }
-            reader.raiseError(QLatin1String("Unexpected element ") + tag);
+            reader.raiseError(QLatin1String("Unexpected element ") + tag.toString());
         }
             break;
         case QXmlStreamReader::EndElement :
@@ -11400,14 +12564,20 @@ void DomDesignerData::read(QXmlStreamReader &reader)
     for (bool finished = false; !finished && !reader.hasError();) {
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
-            const QString tag = reader.name().toString().toLower();
-            if (tag == QLatin1String("property")) {
-                DomProperty *v = new DomProperty();
-                v->read(reader);
-                m_property.append(v);
-                continue;
+            const QStringRef tag = reader.name();
+            switch (tagHash(tag)) {
+            case 0xaf4cdd45u: // property
+                if (tag.compare(QLatin1String("property"), Qt::CaseInsensitive) == 0) {
+                    DomProperty *v = new DomProperty();
+                    v->read(reader);
+                    m_property.append(v);
+                    continue;
+                }
+                break;
+            default:
+                break;
             }
-            reader.raiseError(QLatin1String("Unexpected element ") + tag);
+            reader.raiseError(QLatin1String("Unexpected element ") + tag.toString());
         }
             break;
         case QXmlStreamReader::EndElement :
@@ -11495,16 +12665,24 @@ void DomSlots::read(QXmlStreamReader &reader)
     for (bool finished = false; !finished && !reader.hasError();) {
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
-            const QString tag = reader.name().toString().toLower();
-            if (tag == QLatin1String("signal")) {
-                m_signal.append(reader.readElementText());
-                continue;
-            }
-            if (tag == QLatin1String("slot")) {
-                m_slot.append(reader.readElementText());
-                continue;
+            const QStringRef tag = reader.name();
+            switch (tagHash(tag)) {
+            case 0x13e7a91eu: // signal
+                if (tag.compare(QLatin1String("signal"), Qt::CaseInsensitive) == 0) {
+                    m_signal.append(reader.readElementText());
+                    continue;
+                }
+                break;
+            case 0x0040e9c2u: // slot
+                if (tag.compare(QLatin1String("slot"), Qt::CaseInsensitive) == 0) {
+                    m_slot.append(reader.readElementText());
+                    continue;
+                }
+                break;
+            default:
+                break;
             }
-            reader.raiseError(QLatin1String("Unexpected element ") + tag);
+            reader.raiseError(QLatin1String("Unexpected element ") + tag.toString());
         }
             break;
         case QXmlStreamReader::EndElement :
@@ -161,6 +161,8 @@ class DomConnectionHint;
 class DomTriggers;
 class DomTrigger;
 class DomEvent;
+class DomSelect;
+class DomPipeline;
 // END: Val
 class DomScript;
 class DomWidgetData;
@@ -187,22 +189,22 @@ public:
     // END: Val
 #endif
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
-    inline QString text() const { return m_text; }
+    inline const QString &text() const { return m_text; }
     inline void setText(const QString &s) { m_text = s; }
 
     // attribute accessors
     inline bool hasAttributeVersion() const { return m_has_attr_version; }
-    inline QString attributeVersion() const { return m_attr_version; }
+    inline const QString &attributeVersion() const { return m_attr_version; }
     inline void setAttributeVersion(const QString& a) { m_attr_version = a; m_has_attr_version = true; }
     inline void clearAttributeVersion() { m_has_attr_version = false; }
 
     inline bool hasAttributeLanguage() const { return m_has_attr_language; }
-    inline QString attributeLanguage() const { return m_attr_language; }
+    inline const QString &attributeLanguage() const { return m_attr_language; }
     inline void setAttributeLanguage(const QString& a) { m_attr_language = a; m_has_attr_language = true; }
     inline void clearAttributeLanguage() { m_has_attr_language = false; }
 
     inline bool hasAttributeDisplayname() const { return m_has_attr_displayname; }
-    inline QString attributeDisplayname() const { return m_attr_displayname; }
+    inline const QString &attributeDisplayname() const { return m_attr_displayname; }
     inline void setAttributeDisplayname(const QString& a) { m_attr_displayname = a; m_has_attr_displayname = true; }
     inline void clearAttributeDisplayname() { m_has_attr_displayname = false; }
 
@@ -217,22 +219,22 @@ public:
     inline void clearAttributeStdSetDef() { m_has_attr_stdSetDef = false; }
 
     // child element accessors
-    inline QString elementAuthor() const { return m_author; }
+    inline const QString &elementAuthor() const { return m_author; }
     void setElementAuthor(const QString& a);
     inline bool hasElementAuthor() const { return m_children & Author; }
     void clearElementAuthor();
 
-    inline QString elementComment() const { return m_comment; }
+    inline const QString &elementComment() const { return m_comment; }
     void setElementComment(const QString& a);
     inline bool hasElementComment() const { return m_children & Comment; }
     void clearElementComment();
 
-    inline QString elementExportMacro() const { return m_exportMacro; }
+    inline const QString &elementExportMacro() const { return m_exportMacro; }
     void setElementExportMacro(const QString& a);
     inline bool hasElementExportMacro() const { return m_children & ExportMacro; }
     void clearElementExportMacro();
 
-    inline QString elementClass() const { return m_class; }
+    inline const QString &elementClass() const { return m_class; }
     void setElementClass(const QString& a);
     inline bool hasElementClass() const { return m_children & Class; }
     void clearElementClass();
@@ -255,7 +257,7 @@ public:
     inline bool hasElementLayoutFunction() const { return m_children & LayoutFunction; }
     void clearElementLayoutFunction();
 
-    inline QString elementPixmapFunction() const { return m_pixmapFunction; }
+    inline const QString &elementPixmapFunction() const { return m_pixmapFunction; }
     void setElementPixmapFunction(const QString& a);
     inline bool hasElementPixmapFunction() const { return m_children & PixmapFunction; }
     void clearElementPixmapFunction();
@@ -302,6 +304,11 @@ public:
     void setElementTriggers( DomTriggers* a );
     inline bool hasElementTriggers() const { return m_children & Triggers; }
     void clearElementTriggers();
+
+    inline const QList< DomSelect* > &elementSelect() const { return m_select; }
+    void setElementSelect( const QList< DomSelect* > &a );
+    inline bool hasElementSelect() const { return m_children & Select; }
+    void clearElementSelect();
     // END: Val
 
     inline DomDesignerData* elementDesignerdata() const { return m_designerdata; }
@@ -361,6 +368,7 @@ private:
 
     // BEGIN: Val
     DomTriggers* m_triggers;
+    QList< DomSelect* > m_select;
     // END: Val
 
     DomDesignerData* m_designerdata;
@@ -385,7 +393,8 @@ private:
         Slots = 32768,
         ButtonGroups = 65536,
         // BEGIN: Val
-        Triggers = 131072
+        Triggers = 131072,
+        Select = 262144
         // END: Val
     };
 
@@ -403,12 +412,12 @@ public:
     void read(const QDomElement &node);
 #endif
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
-    inline QString text() const { return m_text; }
+    inline const QString &text() const { return m_text; }
     inline void setText(const QString &s) { m_text = s; }
 
     // attribute accessors
     // child element accessors
-    inline QList<DomInclude*> elementInclude() const { return m_include; }
+    inline const QList<DomInclude*> &elementInclude() const { return m_include; }
     void setElementInclude(const QList<DomInclude*>& a);
 
 private:
@@ -437,17 +446,17 @@ public:
     void read(const QDomElement &node);
 #endif
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
-    inline QString text() const { return m_text; }
+    inline const QString &text() const { return m_text; }
     inline void setText(const QString &s) { m_text = s; }
 
     // attribute accessors
     inline bool hasAttributeLocation() const { return m_has_attr_location; }
-    inline QString attributeLocation() const { return m_attr_location; }
+    inline const QString &attributeLocation() const { return m_attr_location; }
     inline void setAttributeLocation(const QString& a) { m_attr_location = a; m_has_attr_location = true; }
     inline void clearAttributeLocation() { m_has_attr_location = false; }
 
     inline bool hasAttributeImpldecl() const { return m_has_attr_impldecl; }
-    inline QString attributeImpldecl() const { return m_attr_impldecl; }
+    inline const QString &attributeImpldecl() const { return m_attr_impldecl; }
     inline void setAttributeImpldecl(const QString& a) { m_attr_impldecl = a; m_has_attr_impldecl = true; }
     inline void clearAttributeImpldecl() { m_has_attr_impldecl = false; }
 
@@ -480,17 +489,17 @@ public:
     void read(const QDomElement &node);
 #endif
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
-    inline QString text() const { return m_text; }
+    inline const QString &text() const { return m_text; }
     inline void setText(const QString &s) { m_text = s; }
 
     // attribute accessors
     inline bool hasAttributeName() const { return m_has_attr_name; }
-    inline QString attributeName() const { return m_attr_name; }
+    inline const QString &attributeName() const { return m_attr_name; }
     inline void setAttributeName(const QString& a) { m_attr_name = a; m_has_attr_name = true; }
     inline void clearAttributeName() { m_has_attr_name = false; }
 
     // child element accessors
-    inline QList<DomResource*> elementInclude() const { return m_include; }
+    inline const QList<DomResource*> &elementInclude() const { return m_include; }
     void setElementInclude(const QList<DomResource*>& a);
 
 private:
@@ -522,12 +531,12 @@ public:
     void read(const QDomElement &node);
 #endif
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
-    inline QString text() const { return m_text; }
+    inline const QString &text() const { return m_text; }
     inline void setText(const QString &s) { m_text = s; }
 
     // attribute accessors
     inline bool hasAttributeLocation() const { return m_has_attr_location; }
-    inline QString attributeLocation() const { return m_attr_location; }
+    inline const QString &attributeLocation() const { return m_attr_location; }
     inline void setAttributeLocation(const QString& a) { m_attr_location = a; m_has_attr_location = true; }
     inline void clearAttributeLocation() { m_has_attr_location = false; }
 
@@ -557,26 +566,26 @@ public:
     void read(const QDomElement &node);
 #endif
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
-    inline QString text() const { return m_text; }
+    inline const QString &text() const { return m_text; }
     inline void setText(const QString &s) { m_text = s; }
 
     // attribute accessors
     inline bool hasAttributeName() const { return m_has_attr_name; }
-    inline QString attributeName() const { return m_attr_name; }
+    inline const QString &attributeName() const { return m_attr_name; }
     inline void setAttributeName(const QString& a) { m_attr_name = a; m_has_attr_name = true; }
     inline void clearAttributeName() { m_has_attr_name = false; }
 
     // child element accessors
-    inline QList<DomAction*> elementAction() const { return m_action; }
+    inline const QList<DomAction*> &elementAction() const { return m_action; }
     void setElementAction(const QList<DomAction*>& a);
 
-    inline QList<DomActionGroup*> elementActionGroup() const { return m_actionGroup; }
+    inline const QList<DomActionGroup*> &elementActionGroup() const { return m_actionGroup; }
     void setElementActionGroup(const QList<DomActionGroup*>& a);
 
-    inline QList<DomProperty*> elementProperty() const { return m_property; }
+    inline const QList<DomProperty*> &elementProperty() const { return m_property; }
     void setElementProperty(const QList<DomProperty*>& a);
 
-    inline QList<DomProperty*> elementAttribute() const { return m_attribute; }
+    inline const QList<DomProperty*> &elementAttribute() const { return m_attribute; }
     void setElementAttribute(const QList<DomProperty*>& a);
 
 private:
@@ -614,25 +623,25 @@ public:
     void read(const QDomElement &node);
 #endif
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
-    inline QString text() const { return m_text; }
+    inline const QString &text() const { return m_text; }
     inline void setText(const QString &s) { m_text = s; }
 
     // attribute accessors
     inline bool hasAttributeName() const { return m_has_attr_name; }
-    inline QString attributeName() const { return m_attr_name; }
+    inline const QString &attributeName() const { return m_attr_name; }
     inline void setAttributeName(const QString& a) { m_attr_name = a; m_has_attr_name = true; }
     inline void clearAttributeName() { m_has_attr_name = false; }
 
     inline bool hasAttributeMenu() const { return m_has_attr_menu; }
-    inline QString attributeMenu() const { return m_attr_menu; }
+    inline const QString &attributeMenu() const { return m_attr_menu; }
     inline void setAttributeMenu(const QString& a) { m_attr_menu = a; m_has_attr_menu = true; }
     inline void clearAttributeMenu() { m_has_attr_menu = false; }
 
     // child element accessors
-    inline QList<DomProperty*> elementProperty() const { return m_property; }
+    inline const QList<DomProperty*> &elementProperty() const { return m_property; }
     void setElementProperty(const QList<DomProperty*>& a);
 
-    inline QList<DomProperty*> elementAttribute() const { return m_attribute; }
+    inline const QList<DomProperty*> &elementAttribute() const { return m_attribute; }
     void setElementAttribute(const QList<DomProperty*>& a);
 
 private:
@@ -669,12 +678,12 @@ public:
     void read(const QDomElement &node);
 #endif
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
-    inline QString text() const { return m_text; }
+    inline const QString &text() const { return m_text; }
     inline void setText(const QString &s) { m_text = s; }
 
     // attribute accessors
     inline bool hasAttributeName() const { return m_has_attr_name; }
-    inline QString attributeName() const { return m_attr_name; }
+    inline const QString &attributeName() const { return m_attr_name; }
     inline void setAttributeName(const QString& a) { m_attr_name = a; m_has_attr_name = true; }
     inline void clearAttributeName() { m_has_attr_name = false; }
 
@@ -704,20 +713,20 @@ public:
     void read(const QDomElement &node);
 #endif
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
-    inline QString text() const { return m_text; }
+    inline const QString &text() const { return m_text; }
     inline void setText(const QString &s) { m_text = s; }
 
     // attribute accessors
     inline bool hasAttributeName() const { return m_has_attr_name; }
-    inline QString attributeName() const { return m_attr_name; }
+    inline const QString &attributeName() const { return m_attr_name; }
     inline void setAttributeName(const QString& a) { m_attr_name = a; m_has_attr_name = true; }
     inline void clearAttributeName() { m_has_attr_name = false; }
 
     // child element accessors
-    inline QList<DomProperty*> elementProperty() const { return m_property; }
+    inline const QList<DomProperty*> &elementProperty() const { return m_property; }
     void setElementProperty(const QList<DomProperty*>& a);
 
-    inline QList<DomProperty*> elementAttribute() const { return m_attribute; }
+    inline const QList<DomProperty*> &elementAttribute() const { return m_attribute; }
     void setElementAttribute(const QList<DomProperty*>& a);
 
 private:
@@ -751,12 +760,12 @@ public:
     void read(const QDomElement &node);
 #endif
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
-    inline QString text() const { return m_text; }
+    inline const QString &text() const { return m_text; }
     inline void setText(const QString &s) { m_text = s; }
 
     // attribute accessors
     // child element accessors
-    inline QList<DomButtonGroup*> elementButtonGroup() const { return m_buttonGroup; }
+    inline const QList<DomButtonGroup*> &elementButtonGroup() const { return m_buttonGroup; }
     void setElementButtonGroup(const QList<DomButtonGroup*>& a);
 
 private:
@@ -785,12 +794,12 @@ public:
     void read(const QDomElement &node);
 #endif
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
-    inline QString text() const { return m_text; }
+    inline const QString &text() const { return m_text; }
     inline void setText(const QString &s) { m_text = s; }
 
     // attribute accessors
     // child element accessors
-    inline QList<DomImage*> elementImage() const { return m_image; }
+    inline const QList<DomImage*> &elementImage() const { return m_image; }
     void setElementImage(const QList<DomImage*>& a);
 
 private:
@@ -819,12 +828,12 @@ public:
     void read(const QDomElement &node);
 #endif
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
-    inline QString text() const { return m_text; }
+    inline const QString &text() const { return m_text; }
     inline void setText(const QString &s) { m_text = s; }
 
     // attribute accessors
     inline bool hasAttributeName() const { return m_has_attr_name; }
-    inline QString attributeName() const { return m_attr_name; }
+    inline const QString &attributeName() const { return m_attr_name; }
     inline void setAttributeName(const QString& a) { m_attr_name = a; m_has_attr_name = true; }
     inline void clearAttributeName() { m_has_attr_name = false; }
 
@@ -864,12 +873,12 @@ public:
     void read(const QDomElement &node);
 #endif
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
-    inline QString text() const { return m_text; }
+    inline const QString &text() const { return m_text; }
     inline void setText(const QString &s) { m_text = s; }
 
     // attribute accessors
     inline bool hasAttributeFormat() const { return m_has_attr_format; }
-    inline QString attributeFormat() const { return m_attr_format; }
+    inline const QString &attributeFormat() const { return m_attr_format; }
     inline void setAttributeFormat(const QString& a) { m_attr_format = a; m_has_attr_format = true; }
     inline void clearAttributeFormat() { m_has_attr_format = false; }
 
@@ -907,12 +916,12 @@ public:
     void read(const QDomElement &node);
 #endif
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
-    inline QString text() const { return m_text; }
+    inline const QString &text() const { return m_text; }
     inline void setText(const QString &s) { m_text = s; }
 
     // attribute accessors
     // child element accessors
-    inline QList<DomCustomWidget*> elementCustomWidget() const { return m_customWidget; }
+    inline const QList<DomCustomWidget*> &elementCustomWidget() const { return m_customWidget; }
     void setElementCustomWidget(const QList<DomCustomWidget*>& a);
 
 private:
@@ -941,12 +950,12 @@ public:
     void read(const QDomElement &node);
 #endif
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
-    inline QString text() const { return m_text; }
+    inline const QString &text() const { return m_text; }
     inline void setText(const QString &s) { m_text = s; }
 
     // attribute accessors
     inline bool hasAttributeLocation() const { return m_has_attr_location; }
-    inline QString attributeLocation() const { return m_attr_location; }
+    inline const QString &attributeLocation() const { return m_attr_location; }
     inline void setAttributeLocation(const QString& a) { m_attr_location = a; m_has_attr_location = true; }
     inline void clearAttributeLocation() { m_has_attr_location = false; }
 
@@ -976,17 +985,17 @@ public:
     void read(const QDomElement &node);
 #endif
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
-    inline QString text() const { return m_text; }
+    inline const QString &text() const { return m_text; }
     inline void setText(const QString &s) { m_text = s; }
 
     // attribute accessors
     // child element accessors
-    inline QString elementClass() const { return m_class; }
+    inline const QString &elementClass() const { return m_class; }
     void setElementClass(const QString& a);
     inline bool hasElementClass() const { return m_children & Class; }
     void clearElementClass();
 
-    inline QString elementExtends() const { return m_extends; }
+    inline const QString &elementExtends() const { return m_extends; }
     void setElementExtends(const QString& a);
     inline bool hasElementExtends() const { return m_children & Extends; }
     void clearElementExtends();
@@ -1003,7 +1012,7 @@ public:
     inline bool hasElementSizeHint() const { return m_children & SizeHint; }
     void clearElementSizeHint();
 
-    inline QString elementAddPageMethod() const { return m_addPageMethod; }
+    inline const QString &elementAddPageMethod() const { return m_addPageMethod; }
     void setElementAddPageMethod(const QString& a);
     inline bool hasElementAddPageMethod() const { return m_children & AddPageMethod; }
     void clearElementAddPageMethod();
@@ -1019,7 +1028,7 @@ public:
     inline bool hasElementSizePolicy() const { return m_children & SizePolicy; }
     void clearElementSizePolicy();
 
-    inline QString elementPixmap() const { return m_pixmap; }
+    inline const QString &elementPixmap() const { return m_pixmap; }
     void setElementPixmap(const QString& a);
     inline bool hasElementPixmap() const { return m_children & Pixmap; }
     void clearElementPixmap();
@@ -1088,12 +1097,12 @@ public:
     void read(const QDomElement &node);
 #endif
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
-    inline QString text() const { return m_text; }
+    inline const QString &text() const { return m_text; }
     inline void setText(const QString &s) { m_text = s; }
 
     // attribute accessors
     // child element accessors
-    inline QList<DomPropertyData*> elementProperty() const { return m_property; }
+    inline const QList<DomPropertyData*> &elementProperty() const { return m_property; }
     void setElementProperty(const QList<DomPropertyData*>& a);
 
 private:
@@ -1122,12 +1131,12 @@ public:
     void read(const QDomElement &node);
 #endif
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
-    inline QString text() const { return m_text; }
+    inline const QString &text() const { return m_text; }
     inline void setText(const QString &s) { m_text = s; }
 
     // attribute accessors
     inline bool hasAttributeType() const { return m_has_attr_type; }
-    inline QString attributeType() const { return m_attr_type; }
+    inline const QString &attributeType() const { return m_attr_type; }
     inline void setAttributeType(const QString& a) { m_attr_type = a; m_has_attr_type = true; }
     inline void clearAttributeType() { m_has_attr_type = false; }
 
@@ -1157,7 +1166,7 @@ public:
     void read(const QDomElement &node);
 #endif
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
-    inline QString text() const { return m_text; }
+    inline const QString &text() const { return m_text; }
     inline void setText(const QString &s) { m_text = s; }
 
     // attribute accessors
@@ -1200,7 +1209,7 @@ public:
     void read(const QDomElement &node);
 #endif
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
-    inline QString text() const { return m_text; }
+    inline const QString &text() const { return m_text; }
     inline void setText(const QString &s) { m_text = s; }
 
     // attribute accessors
@@ -1243,17 +1252,17 @@ public:
     void read(const QDomElement &node);
 #endif
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
-    inline QString text() const { return m_text; }
+    inline const QString &text() const { return m_text; }
     inline void setText(const QString &s) { m_text = s; }
 
     // attribute accessors
     inline bool hasAttributeSpacing() const { return m_has_attr_spacing; }
-    inline QString attributeSpacing() const { return m_attr_spacing; }
+    inline const QString &attributeSpacing() const { return m_attr_spacing; }
     inline void setAttributeSpacing(const QString& a) { m_attr_spacing = a; m_has_attr_spacing = true; }
     inline void clearAttributeSpacing() { m_has_attr_spacing = false; }
 
     inline bool hasAttributeMargin() const { return m_has_attr_margin; }
-    inline QString attributeMargin() const { return m_attr_margin; }
+    inline const QString &attributeMargin() const { return m_attr_margin; }
     inline void setAttributeMargin(const QString& a) { m_attr_margin = a; m_has_attr_margin = true; }
     inline void clearAttributeMargin() { m_has_attr_margin = false; }
 
@@ -1286,12 +1295,12 @@ public:
     void read(const QDomElement &node);
 #endif
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
-    inline QString text() const { return m_text; }
+    inline const QString &text() const { return m_text; }
     inline void setText(const QString &s) { m_text = s; }
 
     // attribute accessors
     // child element accessors
-    inline QStringList elementTabStop() const { return m_tabStop; }
+    inline const QStringList &elementTabStop() const { return m_tabStop; }
     void setElementTabStop(const QStringList& a);
 
 private:
@@ -1320,53 +1329,53 @@ public:
     void read(const QDomElement &node);
 #endif
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
-    inline QString text() const { return m_text; }
+    inline const QString &text() const { return m_text; }
     inline void setText(const QString &s) { m_text = s; }
 
     // attribute accessors
     inline bool hasAttributeClass() const { return m_has_attr_class; }
-    inline QString attributeClass() const { return m_attr_class; }
+    inline const QString &attributeClass() const { return m_attr_class; }
     inline void setAttributeClass(const QString& a) { m_attr_class = a; m_has_attr_class = true; }
     inline void clearAttributeClass() { m_has_attr_class = false; }
 
     inline bool hasAttributeName() const { return m_has_attr_name; }
-    inline QString attributeName() const { return m_attr_name; }
+    inline const QString &attributeName() const { return m_attr_name; }
     inline void setAttributeName(const QString& a) { m_attr_name = a; m_has_attr_name = true; }
     inline void clearAttributeName() { m_has_attr_name = false; }
 
     inline bool hasAttributeStretch() const { return m_has_attr_stretch; }
-    inline QString attributeStretch() const { return m_attr_stretch; }
+    inline const QString &attributeStretch() const { return m_attr_stretch; }
     inline void setAttributeStretch(const QString& a) { m_attr_stretch = a; m_has_attr_stretch = true; }
     inline void clearAttributeStretch() { m_has_attr_stretch = false; }
 
     inline bool hasAttributeRowStretch() const { return m_has_attr_rowStretch; }
-    inline QString attributeRowStretch() const { return m_attr_rowStretch; }
+    inline const QString &attributeRowStretch() const { return m_attr_rowStretch; }
     inline void setAttributeRowStretch(const QString& a) { m_attr_rowStretch = a; m_has_attr_rowStretch = true; }
     inline void clearAttributeRowStretch() { m_has_attr_rowStretch = false; }
 
     inline bool hasAttributeColumnStretch() const { return m_has_attr_columnStretch; }
-    inline QString attributeColumnStretch() const { return m_attr_columnStretch; }
+    inline const QString &attributeColumnStretch() const { return m_attr_columnStretch; }
     inline void setAttributeColumnStretch(const QString& a) { m_attr_columnStretch = a; m_has_attr_columnStretch = true; }
     inline void clearAttributeColumnStretch() { m_has_attr_columnStretch = false; }
 
     inline bool hasAttributeRowMinimumHeight() const { return m_has_attr_rowMinimumHeight; }
-    inline QString attributeRowMinimumHeight() const { return m_attr_rowMinimumHeight; }
+    inline const QString &attributeRowMinimumHeight() const { return m_attr_rowMinimumHeight; }
     inline void setAttributeRowMinimumHeight(const QString& a) { m_attr_rowMinimumHeight = a; m_has_attr_rowMinimumHeight = true; }
     inline void clearAttributeRowMinimumHeight() { m_has_attr_rowMinimumHeight = false; }
 
     inline bool hasAttributeColumnMinimumWidth() const { return m_has_attr_columnMinimumWidth; }
-    inline QString attributeColumnMinimumWidth() const { return m_attr_columnMinimumWidth; }
+    inline const QString &attributeColumnMinimumWidth() const { return m_attr_columnMinimumWidth; }
     inline void setAttributeColumnMinimumWidth(const QString& a) { m_attr_columnMinimumWidth = a; m_has_attr_columnMinimumWidth = true; }
     inline void clearAttributeColumnMinimumWidth() { m_has_attr_columnMinimumWidth = false; }
 
     // child element accessors
-    inline QList<DomProperty*> elementProperty() const { return m_property; }
+    inline const QList<DomProperty*> &elementProperty() const { return m_property; }
     void setElementProperty(const QList<DomProperty*>& a);
 
-    inline QList<DomProperty*> elementAttribute() const { return m_attribute; }
+    inline const QList<DomProperty*> &elementAttribute() const { return m_attribute; }
     void setElementAttribute(const QList<DomProperty*>& a);
 
-    inline QList<DomLayoutItem*> elementItem() const { return m_item; }
+    inline const QList<DomLayoutItem*> &elementItem() const { return m_item; }
     void setElementItem(const QList<DomLayoutItem*>& a);
 
 private:
@@ -1420,7 +1429,7 @@ public:
     void read(const QDomElement &node);
 #endif
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
-    inline QString text() const { return m_text; }
+    inline const QString &text() const { return m_text; }
     inline void setText(const QString &s) { m_text = s; }
 
     // attribute accessors
@@ -1497,12 +1506,12 @@ public:
     void read(const QDomElement &node);
 #endif
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
-    inline QString text() const { return m_text; }
+    inline const QString &text() const { return m_text; }
     inline void setText(const QString &s) { m_text = s; }
 
     // attribute accessors
     // child element accessors
-    inline QList<DomProperty*> elementProperty() const { return m_property; }
+    inline const QList<DomProperty*> &elementProperty() const { return m_property; }
     void setElementProperty(const QList<DomProperty*>& a);
 
 private:
@@ -1531,12 +1540,12 @@ public:
     void read(const QDomElement &node);
 #endif
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
-    inline QString text() const { return m_text; }
+    inline const QString &text() const { return m_text; }
     inline void setText(const QString &s) { m_text = s; }
 
     // attribute accessors
     // child element accessors
-    inline QList<DomProperty*> elementProperty() const { return m_property; }
+    inline const QList<DomProperty*> &elementProperty() const { return m_property; }
     void setElementProperty(const QList<DomProperty*>& a);
 
 private:
@@ -1565,7 +1574,7 @@ public:
     void read(const QDomElement &node);
 #endif
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
-    inline QString text() const { return m_text; }
+    inline const QString &text() const { return m_text; }
     inline void setText(const QString &s) { m_text = s; }
 
     // attribute accessors
@@ -1580,10 +1589,10 @@ public:
     inline void clearAttributeColumn() { m_has_attr_column = false; }
 
     // child element accessors
-    inline QList<DomProperty*> elementProperty() const { return m_property; }
+    inline const QList<DomProperty*> &elementProperty() const { return m_property; }
     void setElementProperty(const QList<DomProperty*>& a);
 
-    inline QList<DomItem*> elementItem() const { return m_item; }
+    inline const QList<DomItem*> &elementItem() const { return m_item; }
     void setElementItem(const QList<DomItem*>& a);
 
 private:
@@ -1620,17 +1629,17 @@ public:
     void read(const QDomElement &node);
 #endif
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
-    inline QString text() const { return m_text; }
+    inline const QString &text() const { return m_text; }
     inline void setText(const QString &s) { m_text = s; }
 
     // attribute accessors
     inline bool hasAttributeClass() const { return m_has_attr_class; }
-    inline QString attributeClass() const { return m_attr_class; }
+    inline const QString &attributeClass() const { return m_attr_class; }
     inline void setAttributeClass(const QString& a) { m_attr_class = a; m_has_attr_class = true; }
     inline void clearAttributeClass() { m_has_attr_class = false; }
 
     inline bool hasAttributeName() const { return m_has_attr_name; }
-    inline QString attributeName() const { return m_attr_name; }
+    inline const QString &attributeName() const { return m_attr_name; }
     inline void setAttributeName(const QString& a) { m_attr_name = a; m_has_attr_name = true; }
     inline void clearAttributeName() { m_has_attr_name = false; }
 
@@ -1640,46 +1649,46 @@ public:
     inline void clearAttributeNative() { m_has_attr_native = false; }
 
     // child element accessors
-    inline QStringList elementClass() const { return m_class; }
+    inline const QStringList &elementClass() const { return m_class; }
     void setElementClass(const QStringList& a);
 
-    inline QList<DomProperty*> elementProperty() const { return m_property; }
+    inline const QList<DomProperty*> &elementProperty() const { return m_property; }
     void setElementProperty(const QList<DomProperty*>& a);
 
-    inline QList<DomScript*> elementScript() const { return m_script; }
+    inline const QList<DomScript*> &elementScript() const { return m_script; }
     void setElementScript(const QList<DomScript*>& a);
 
-    inline QList<DomWidgetData*> elementWidgetData() const { return m_widgetData; }
+    inline const QList<DomWidgetData*> &elementWidgetData() const { return m_widgetData; }
     void setElementWidgetData(const QList<DomWidgetData*>& a);
 
-    inline QList<DomProperty*> elementAttribute() const { return m_attribute; }
+    inline const QList<DomProperty*> &elementAttribute() const { return m_attribute; }
     void setElementAttribute(const QList<DomProperty*>& a);
 
-    inline QList<DomRow*> elementRow() const { return m_row; }
+    inline const QList<DomRow*> &elementRow() const { return m_row; }
     void setElementRow(const QList<DomRow*>& a);
 
-    inline QList<DomColumn*> elementColumn() const { return m_column; }
+    inline const QList<DomColumn*> &elementColumn() const { return m_column; }
     void setElementColumn(const QList<DomColumn*>& a);
 
-    inline QList<DomItem*> elementItem() const { return m_item; }
+    inline const QList<DomItem*> &elementItem() const { return m_item; }
     void setElementItem(const QList<DomItem*>& a);
 
-    inline QList<DomLayout*> elementLayout() const { return m_layout; }
+    inline const QList<DomLayout*> &elementLayout() const { return m_layout; }
     void setElementLayout(const QList<DomLayout*>& a);
 
-    inline QList<DomWidget*> elementWidget() const { return m_widget; }
+    inline const QList<DomWidget*> &elementWidget() const { return m_widget; }
     void setElementWidget(const QList<DomWidget*>& a);
 
-    inline QList<DomAction*> elementAction() const { return m_action; }
+    inline const QList<DomAction*> &elementAction() const { return m_action; }
     void setElementAction(const QList<DomAction*>& a);
 
-    inline QList<DomActionGroup*> elementActionGroup() const { return m_actionGroup; }
+    inline const QList<DomActionGroup*> &elementActionGroup() const { return m_actionGroup; }
     void setElementActionGroup(const QList<DomActionGroup*>& a);
 
-    inline QList<DomActionRef*> elementAddAction() const { return m_addAction; }
+    inline const QList<DomActionRef*> &elementAddAction() const { return m_addAction; }
     void setElementAddAction(const QList<DomActionRef*>& a);
 
-    inline QStringList elementZOrder() const { return m_zOrder; }
+    inline const QStringList &elementZOrder() const { return m_zOrder; }
     void setElementZOrder(const QStringList& a);
 
 private:
@@ -1743,17 +1752,17 @@ public:
     void read(const QDomElement &node);
 #endif
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
-    inline QString text() const { return m_text; }
+    inline const QString &text() const { return m_text; }
     inline void setText(const QString &s) { m_text = s; }
 
     // attribute accessors
     inline bool hasAttributeName() const { return m_has_attr_name; }
-    inline QString attributeName() const { return m_attr_name; }
+    inline const QString &attributeName() const { return m_attr_name; }
     inline void setAttributeName(const QString& a) { m_attr_name = a; m_has_attr_name = true; }
     inline void clearAttributeName() { m_has_attr_name = false; }
 
     // child element accessors
-    inline QList<DomProperty*> elementProperty() const { return m_property; }
+    inline const QList<DomProperty*> &elementProperty() const { return m_property; }
     void setElementProperty(const QList<DomProperty*>& a);
 
 private:
@@ -1785,7 +1794,7 @@ public:
     void read(const QDomElement &node);
 #endif
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
-    inline QString text() const { return m_text; }
+    inline const QString &text() const { return m_text; }
     inline void setText(const QString &s) { m_text = s; }
 
     // attribute accessors
@@ -1843,7 +1852,7 @@ public:
     void read(const QDomElement &node);
 #endif
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
-    inline QString text() const { return m_text; }
+    inline const QString &text() const { return m_text; }
     inline void setText(const QString &s) { m_text = s; }
 
     // attribute accessors
@@ -1888,7 +1897,7 @@ public:
     void read(const QDomElement &node);
 #endif
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
-    inline QString text() const { return m_text; }
+    inline const QString &text() const { return m_text; }
     inline void setText(const QString &s) { m_text = s; }
 
     // attribute accessors
@@ -1943,22 +1952,22 @@ public:
     inline void clearAttributeAngle() { m_has_attr_angle = false; }
 
     inline bool hasAttributeType() const { return m_has_attr_type; }
-    inline QString attributeType() const { return m_attr_type; }
+    inline const QString &attributeType() const { return m_attr_type; }
     inline void setAttributeType(const QString& a) { m_attr_type = a; m_has_attr_type = true; }
     inline void clearAttributeType() { m_has_attr_type = false; }
 
     inline bool hasAttributeSpread() const { return m_has_attr_spread; }
-    inline QString attributeSpread() const { return m_attr_spread; }
+    inline const QString &attributeSpread() const { return m_attr_spread; }
     inline void setAttributeSpread(const QString& a) { m_attr_spread = a; m_has_attr_spread = true; }
     inline void clearAttributeSpread() { m_has_attr_spread = false; }
 
     inline bool hasAttributeCoordinateMode() const { return m_has_attr_coordinateMode; }
-    inline QString attributeCoordinateMode() const { return m_attr_coordinateMode; }
+    inline const QString &attributeCoordinateMode() const { return m_attr_coordinateMode; }
     inline void setAttributeCoordinateMode(const QString& a) { m_attr_coordinateMode = a; m_has_attr_coordinateMode = true; }
     inline void clearAttributeCoordinateMode() { m_has_attr_coordinateMode = false; }
 
     // child element accessors
-    inline QList<DomGradientStop*> elementGradientStop() const { return m_gradientStop; }
+    inline const QList<DomGradientStop*> &elementGradientStop() const { return m_gradientStop; }
     void setElementGradientStop(const QList<DomGradientStop*>& a);
 
 private:
@@ -2026,12 +2035,12 @@ public:
     void read(const QDomElement &node);
 #endif
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
-    inline QString text() const { return m_text; }
+    inline const QString &text() const { return m_text; }
     inline void setText(const QString &s) { m_text = s; }
 
     // attribute accessors
     inline bool hasAttributeBrushStyle() const { return m_has_attr_brushStyle; }
-    inline QString attributeBrushStyle() const { return m_attr_brushStyle; }
+    inline const QString &attributeBrushStyle() const { return m_attr_brushStyle; }
     inline void setAttributeBrushStyle(const QString& a) { m_attr_brushStyle = a; m_has_attr_brushStyle = true; }
     inline void clearAttributeBrushStyle() { m_has_attr_brushStyle = false; }
 
@@ -2079,12 +2088,12 @@ public:
     void read(const QDomElement &node);
 #endif
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
-    inline QString text() const { return m_text; }
+    inline const QString &text() const { return m_text; }
     inline void setText(const QString &s) { m_text = s; }
 
     // attribute accessors
     inline bool hasAttributeRole() const { return m_has_attr_role; }
-    inline QString attributeRole() const { return m_attr_role; }
+    inline const QString &attributeRole() const { return m_attr_role; }
     inline void setAttributeRole(const QString& a) { m_attr_role = a; m_has_attr_role = true; }
     inline void clearAttributeRole() { m_has_attr_role = false; }
 
@@ -2124,15 +2133,15 @@ public:
     void read(const QDomElement &node);
 #endif
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
-    inline QString text() const { return m_text; }
+    inline const QString &text() const { return m_text; }
     inline void setText(const QString &s) { m_text = s; }
 
     // attribute accessors
     // child element accessors
-    inline QList<DomColorRole*> elementColorRole() const { return m_colorRole; }
+    inline const QList<DomColorRole*> &elementColorRole() const { return m_colorRole; }
     void setElementColorRole(const QList<DomColorRole*>& a);
 
-    inline QList<DomColor*> elementColor() const { return m_color; }
+    inline const QList<DomColor*> &elementColor() const { return m_color; }
     void setElementColor(const QList<DomColor*>& a);
 
 private:
@@ -2163,7 +2172,7 @@ public:
     void read(const QDomElement &node);
 #endif
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
-    inline QString text() const { return m_text; }
+    inline const QString &text() const { return m_text; }
     inline void setText(const QString &s) { m_text = s; }
 
     // attribute accessors
@@ -2216,12 +2225,12 @@ public:
     void read(const QDomElement &node);
 #endif
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
-    inline QString text() const { return m_text; }
+    inline const QString &text() const { return m_text; }
     inline void setText(const QString &s) { m_text = s; }
 
     // attribute accessors
     // child element accessors
-    inline QString elementFamily() const { return m_family; }
+    inline const QString &elementFamily() const { return m_family; }
     void setElementFamily(const QString& a);
     inline bool hasElementFamily() const { return m_children & Family; }
     void clearElementFamily();
@@ -2261,7 +2270,7 @@ public:
     inline bool hasElementAntialiasing() const { return m_children & Antialiasing; }
     void clearElementAntialiasing();
 
-    inline QString elementStyleStrategy() const { return m_styleStrategy; }
+    inline const QString &elementStyleStrategy() const { return m_styleStrategy; }
     void setElementStyleStrategy(const QString& a);
     inline bool hasElementStyleStrategy() const { return m_children & StyleStrategy; }
     void clearElementStyleStrategy();
@@ -2315,7 +2324,7 @@ public:
     void read(const QDomElement &node);
 #endif
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
-    inline QString text() const { return m_text; }
+    inline const QString &text() const { return m_text; }
     inline void setText(const QString &s) { m_text = s; }
 
     // attribute accessors
@@ -2358,7 +2367,7 @@ public:
     void read(const QDomElement &node);
 #endif
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
-    inline QString text() const { return m_text; }
+    inline const QString &text() const { return m_text; }
     inline void setText(const QString &s) { m_text = s; }
 
     // attribute accessors
@@ -2415,17 +2424,17 @@ public:
     void read(const QDomElement &node);
 #endif
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
-    inline QString text() const { return m_text; }
+    inline const QString &text() const { return m_text; }
     inline void setText(const QString &s) { m_text = s; }
 
     // attribute accessors
     inline bool hasAttributeLanguage() const { return m_has_attr_language; }
-    inline QString attributeLanguage() const { return m_attr_language; }
+    inline const QString &attributeLanguage() const { return m_attr_language; }
     inline void setAttributeLanguage(const QString& a) { m_attr_language = a; m_has_attr_language = true; }
     inline void clearAttributeLanguage() { m_has_attr_language = false; }
 
     inline bool hasAttributeCountry() const { return m_has_attr_country; }
-    inline QString attributeCountry() const { return m_attr_country; }
+    inline const QString &attributeCountry() const { return m_attr_country; }
     inline void setAttributeCountry(const QString& a) { m_attr_country = a; m_has_attr_country = true; }
     inline void clearAttributeCountry() { m_has_attr_country = false; }
 
@@ -2458,17 +2467,17 @@ public:
     void read(const QDomElement &node);
 #endif
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
-    inline QString text() const { return m_text; }
+    inline const QString &text() const { return m_text; }
     inline void setText(const QString &s) { m_text = s; }
 
     // attribute accessors
     inline bool hasAttributeHSizeType() const { return m_has_attr_hSizeType; }
-    inline QString attributeHSizeType() const { return m_attr_hSizeType; }
+    inline const QString &attributeHSizeType() const { return m_attr_hSizeType; }
     inline void setAttributeHSizeType(const QString& a) { m_attr_hSizeType = a; m_has_attr_hSizeType = true; }
     inline void clearAttributeHSizeType() { m_has_attr_hSizeType = false; }
 
     inline bool hasAttributeVSizeType() const { return m_has_attr_vSizeType; }
-    inline QString attributeVSizeType() const { return m_attr_vSizeType; }
+    inline const QString &attributeVSizeType() const { return m_attr_vSizeType; }
     inline void setAttributeVSizeType(const QString& a) { m_attr_vSizeType = a; m_has_attr_vSizeType = true; }
     inline void clearAttributeVSizeType() { m_has_attr_vSizeType = false; }
 
@@ -2531,7 +2540,7 @@ public:
     void read(const QDomElement &node);
 #endif
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
-    inline QString text() const { return m_text; }
+    inline const QString &text() const { return m_text; }
     inline void setText(const QString &s) { m_text = s; }
 
     // attribute accessors
@@ -2574,7 +2583,7 @@ public:
     void read(const QDomElement &node);
 #endif
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
-    inline QString text() const { return m_text; }
+    inline const QString &text() const { return m_text; }
     inline void setText(const QString &s) { m_text = s; }
 
     // attribute accessors
@@ -2624,7 +2633,7 @@ public:
     void read(const QDomElement &node);
 #endif
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
-    inline QString text() const { return m_text; }
+    inline const QString &text() const { return m_text; }
     inline void setText(const QString &s) { m_text = s; }
 
     // attribute accessors
@@ -2674,7 +2683,7 @@ public:
     void read(const QDomElement &node);
 #endif
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
-    inline QString text() const { return m_text; }
+    inline const QString &text() const { return m_text; }
     inline void setText(const QString &s) { m_text = s; }
 
     // attribute accessors
@@ -2745,12 +2754,12 @@ public:
     void read(const QDomElement &node);
 #endif
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
-    inline QString text() const { return m_text; }
+    inline const QString &text() const { return m_text; }
     inline void setText(const QString &s) { m_text = s; }
 
     // attribute accessors
     // child element accessors
-    inline QStringList elementString() const { return m_string; }
+    inline const QStringList &elementString() const { return m_string; }
     void setElementString(const QStringList& a);
 
 private:
@@ -2779,17 +2788,17 @@ public:
     void read(const QDomElement &node);
 #endif
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
-    inline QString text() const { return m_text; }
+    inline const QString &text() const { return m_text; }
     inline void setText(const QString &s) { m_text = s; }
 
     // attribute accessors
     inline bool hasAttributeResource() const { return m_has_attr_resource; }
-    inline QString attributeResource() const { return m_attr_resource; }
+    inline const QString &attributeResource() const { return m_attr_resource; }
     inline void setAttributeResource(const QString& a) { m_attr_resource = a; m_has_attr_resource = true; }
     inline void clearAttributeResource() { m_has_attr_resource = false; }
 
     inline bool hasAttributeAlias() const { return m_has_attr_alias; }
-    inline QString attributeAlias() const { return m_attr_alias; }
+    inline const QString &attributeAlias() const { return m_attr_alias; }
     inline void setAttributeAlias(const QString& a) { m_attr_alias = a; m_has_attr_alias = true; }
     inline void clearAttributeAlias() { m_has_attr_alias = false; }
 
@@ -2822,12 +2831,12 @@ public:
     void read(const QDomElement &node);
 #endif
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
-    inline QString text() const { return m_text; }
+    inline const QString &text() const { return m_text; }
     inline void setText(const QString &s) { m_text = s; }
 
     // attribute accessors
     inline bool hasAttributeResource() const { return m_has_attr_resource; }
-    inline QString attributeResource() const { return m_attr_resource; }
+    inline const QString &attributeResource() const { return m_attr_resource; }
     inline void setAttributeResource(const QString& a) { m_attr_resource = a; m_has_attr_resource = true; }
     inline void clearAttributeResource() { m_has_attr_resource = false; }
 
@@ -2923,22 +2932,22 @@ public:
     void read(const QDomElement &node);
 #endif
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
-    inline QString text() const { return m_text; }
+    inline const QString &text() const { return m_text; }
     inline void setText(const QString &s) { m_text = s; }
 
     // attribute accessors
     inline bool hasAttributeNotr() const { return m_has_attr_notr; }
-    inline QString attributeNotr() const { return m_attr_notr; }
+    inline const QString &attributeNotr() const { return m_attr_notr; }
     inline void setAttributeNotr(const QString& a) { m_attr_notr = a; m_has_attr_notr = true; }
     inline void clearAttributeNotr() { m_has_attr_notr = false; }
 
     inline bool hasAttributeComment() const { return m_has_attr_comment; }
-    inline QString attributeComment() const { return m_attr_comment; }
+    inline const QString &attributeComment() const { return m_attr_comment; }
     inline void setAttributeComment(const QString& a) { m_attr_comment = a; m_has_attr_comment = true; }
     inline void clearAttributeComment() { m_has_attr_comment = false; }
 
     inline bool hasAttributeExtraComment() const { return m_has_attr_extraComment; }
-    inline QString attributeExtraComment() const { return m_attr_extraComment; }
+    inline const QString &attributeExtraComment() const { return m_attr_extraComment; }
     inline void setAttributeExtraComment(const QString& a) { m_attr_extraComment = a; m_has_attr_extraComment = true; }
     inline void clearAttributeExtraComment() { m_has_attr_extraComment = false; }
 
@@ -2974,7 +2983,7 @@ public:
     void read(const QDomElement &node);
 #endif
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
-    inline QString text() const { return m_text; }
+    inline const QString &text() const { return m_text; }
     inline void setText(const QString &s) { m_text = s; }
 
     // attribute accessors
@@ -3017,7 +3026,7 @@ public:
     void read(const QDomElement &node);
 #endif
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
-    inline QString text() const { return m_text; }
+    inline const QString &text() const { return m_text; }
     inline void setText(const QString &s) { m_text = s; }
 
     // attribute accessors
@@ -3074,7 +3083,7 @@ public:
     void read(const QDomElement &node);
 #endif
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
-    inline QString text() const { return m_text; }
+    inline const QString &text() const { return m_text; }
     inline void setText(const QString &s) { m_text = s; }
 
     // attribute accessors
@@ -3117,7 +3126,7 @@ public:
     void read(const QDomElement &node);
 #endif
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
-    inline QString text() const { return m_text; }
+    inline const QString &text() const { return m_text; }
     inline void setText(const QString &s) { m_text = s; }
 
     // attribute accessors
@@ -3153,7 +3162,7 @@ public:
     void read(const QDomElement &node);
 #endif
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
-    inline QString text() const { return m_text; }
+    inline const QString &text() const { return m_text; }
     inline void setText(const QString &s) { m_text = s; }
 
     // attribute accessors
@@ -3190,12 +3199,12 @@ public:
     void read(const QDomElement &node);
 #endif
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
-    inline QString text() const { return m_text; }
+    inline const QString &text() const { return m_text; }
     inline void setText(const QString &s) { m_text = s; }
 
     // attribute accessors
     inline bool hasAttributeName() const { return m_has_attr_name; }
-    inline QString attributeName() const { return m_attr_name; }
+    inline const QString &attributeName() const { return m_attr_name; }
     inline void setAttributeName(const QString& a) { m_attr_name = a; m_has_attr_name = true; }
     inline void clearAttributeName() { m_has_attr_name = false; }
 
@@ -3208,23 +3217,23 @@ public:
     enum Kind { Unknown = 0, Bool, Color, Cstring, Cursor, CursorShape, Enum, Font, IconSet, Pixmap, Palette, Point, Rect, Set, Locale, SizePolicy, Size, String, StringList, Number, Float, Double, Date, Time, DateTime, PointF, RectF, SizeF, LongLong, Char, Url, UInt, ULongLong, Brush };
     inline Kind kind() const { return m_kind; }
 
-    inline QString elementBool() const { return m_bool; }
+    inline const QString &elementBool() const { return m_bool; }
     void setElementBool(const QString& a);
 
     inline DomColor* elementColor() const { return m_color; }
     DomColor* takeElementColor();
     void setElementColor(DomColor* a);
 
-    inline QString elementCstring() const { return m_cstring; }
+    inline const QString &elementCstring() const { return m_cstring; }
     void setElementCstring(const QString& a);
 
     inline int elementCursor() const { return m_cursor; }
     void setElementCursor(int a);
 
-    inline QString elementCursorShape() const { return m_cursorShape; }
+    inline const QString &elementCursorShape() const { return m_cursorShape; }
     void setElementCursorShape(const QString& a);
 
-    inline QString elementEnum() const { return m_enum; }
+    inline const QString &elementEnum() const { return m_enum; }
     void setElementEnum(const QString& a);
 
     inline DomFont* elementFont() const { return m_font; }
@@ -3251,7 +3260,7 @@ public:
     DomRect* takeElementRect();
     void setElementRect(DomRect* a);
 
-    inline QString elementSet() const { return m_set; }
+    inline const QString &elementSet() const { return m_set; }
     void setElementSet(const QString& a);
 
     inline DomLocale* elementLocale() const { return m_locale; }
@@ -3389,12 +3398,12 @@ public:
     void read(const QDomElement &node);
 #endif
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
-    inline QString text() const { return m_text; }
+    inline const QString &text() const { return m_text; }
     inline void setText(const QString &s) { m_text = s; }
 
     // attribute accessors
     // child element accessors
-    inline QList<DomConnection*> elementConnection() const { return m_connection; }
+    inline const QList<DomConnection*> &elementConnection() const { return m_connection; }
     void setElementConnection(const QList<DomConnection*>& a);
 
 private:
@@ -3423,27 +3432,27 @@ public:
     void read(const QDomElement &node);
 #endif
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
-    inline QString text() const { return m_text; }
+    inline const QString &text() const { return m_text; }
     inline void setText(const QString &s) { m_text = s; }
 
     // attribute accessors
     // child element accessors
-    inline QString elementSender() const { return m_sender; }
+    inline const QString &elementSender() const { return m_sender; }
     void setElementSender(const QString& a);
     inline bool hasElementSender() const { return m_children & Sender; }
     void clearElementSender();
 
-    inline QString elementSignal() const { return m_signal; }
+    inline const QString &elementSignal() const { return m_signal; }
     void setElementSignal(const QString& a);
     inline bool hasElementSignal() const { return m_children & Signal; }
     void clearElementSignal();
 
-    inline QString elementReceiver() const { return m_receiver; }
+    inline const QString &elementReceiver() const { return m_receiver; }
     void setElementReceiver(const QString& a);
     inline bool hasElementReceiver() const { return m_children & Receiver; }
     void clearElementReceiver();
 
-    inline QString elementSlot() const { return m_slot; }
+    inline const QString &elementSlot() const { return m_slot; }
     void setElementSlot(const QString& a);
     inline bool hasElementSlot() const { return m_children & Slot; }
     void clearElementSlot();
@@ -3488,12 +3497,12 @@ public:
     void read(const QDomElement &node);
 #endif
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
-    inline QString text() const { return m_text; }
+    inline const QString &text() const { return m_text; }
     inline void setText(const QString &s) { m_text = s; }
 
     // attribute accessors
     // child element accessors
-    inline QList<DomConnectionHint*> elementHint() const { return m_hint; }
+    inline const QList<DomConnectionHint*> &elementHint() const { return m_hint; }
     void setElementHint(const QList<DomConnectionHint*>& a);
 
 private:
@@ -3522,12 +3531,12 @@ public:
     void read(const QDomElement &node);
 #endif
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
-    inline QString text() const { return m_text; }
+    inline const QString &text() const { return m_text; }
     inline void setText(const QString &s) { m_text = s; }
 
     // attribute accessors
     inline bool hasAttributeType() const { return m_has_attr_type; }
-    inline QString attributeType() const { return m_attr_type; }
+    inline const QString &attributeType() const { return m_attr_type; }
     inline void setAttributeType(const QString& a) { m_attr_type = a; m_has_attr_type = true; }
     inline void clearAttributeType() { m_has_attr_type = false; }
 
@@ -3575,7 +3584,7 @@ public:
     void read( const QDomElement &node );
 #endif
     void write( QXmlStreamWriter &writer, const QString &tagName = QString() ) const;
-    inline QString text() const { return m_text; }
+    inline const QString &text() const { return m_text; }
     inline void setText( const QString &s ) { m_text = s; }
 
     // attribute accessors
@@ -3610,15 +3619,30 @@ public:
     void read( const QDomElement &node );
 #endif
     void write( QXmlStreamWriter &writer, const QString &tagName = QString() ) const;
-    inline QString text() const { return m_text; }
+    inline const QString &text() const { return m_text; }
     inline void setText( const QString &s ) { m_text = s; }
 
     // attribute accessors
     inline bool hasAttributeObject() const { return m_has_attr_object; }
-    inline QString attributeObject() const { return m_attr_object; }
+    inline const QString &attributeObject() const { return m_attr_object; }
     inline void setAttributeObject( const QString& a ) { m_attr_object = a; m_has_attr_object = true; }
     inline void clearAttributeObject() { m_has_attr_object = false; }
 
+    inline bool hasAttributeClass() const { return m_has_attr_class; }
+    inline const QString &attributeClass() const { return m_attr_class; }
+    inline void setAttributeClass( const QString& a ) { m_attr_class = a; m_has_attr_class = true; }
+    inline void clearAttributeClass() { m_has_attr_class = false; }
+
+    inline bool hasAttributeMatch() const { return m_has_attr_match; }
+    inline const QString &attributeMatch() const { return m_attr_match; }
+    inline void setAttributeMatch( const QString& a ) { m_attr_match = a; m_has_attr_match = true; }
+    inline void clearAttributeMatch() { m_has_attr_match = false; }
+
+    inline bool hasAttributeProperty() const { return m_has_attr_property; }
+    inline const QString &attributeProperty() const { return m_attr_property; }
+    inline void setAttributeProperty( const QString& a ) { m_attr_property = a; m_has_attr_property = true; }
+    inline void clearAttributeProperty() { m_has_attr_property = false; }
+
     // child element accessors
     inline QList< DomEvent* > elementEvent() const { return m_event; }
     void setElementEvent( const QList< DomEvent* > &a );
@@ -3630,6 +3654,12 @@ private:
     // attribute data
     QString m_attr_object;
     bool m_has_attr_object;
+    QString m_attr_class;
+    bool m_has_attr_class;
+    QString m_attr_match;
+    bool m_has_attr_match;
+    QString m_attr_property;
+    bool m_has_attr_property;
 
     // child element data
     QList< DomEvent* > m_event;
@@ -3652,21 +3682,47 @@ public:
     void read( const QDomElement &node );
 #endif
     void write( QXmlStreamWriter &writer, const QString &tagName = QString() ) const;
-    inline QString text() const { return m_text; }
+    inline const QString &text() const { return m_text; }
     inline void setText(const QString &s) { m_text = s; }
 
     // attribute accessors
     inline bool hasAttributeSignal() const { return m_has_attr_signal; }
-    inline QString attributeSignal() const { return m_attr_signal; }
+    inline const QString &attributeSignal() const { return m_attr_signal; }
     inline void setAttributeSignal( const QString &a ) { m_attr_signal = a; m_has_attr_signal = true; }
     inline void clearAttributeSignal() { m_has_attr_signal = false; }
 
     inline bool hasAttributeAction() const { return m_has_attr_action; }
-    inline QString attributeAction() const { return m_attr_action; }
+    inline const QString &attributeAction() const { return m_attr_action; }
     inline void setAttributeAction( const QString &a ) { m_attr_action = a; m_has_attr_action = true; }
     inline void clearAttributeAction() { m_has_attr_action = false; }
 
+    inline bool hasAttributeInput() const { return m_has_attr_input; }
+    inline const QString &attributeInput() const { return m_attr_input; }
+    inline void setAttributeInput( const QString &a ) { m_attr_input = a; m_has_attr_input = true; }
+    inline void clearAttributeInput() { m_has_attr_input = false; }
+
+    inline bool hasAttributeWidgets() const { return m_has_attr_widgets; }
+    inline const QString &attributeWidgets() const { return m_attr_widgets; }
+    inline void setAttributeWidgets( const QString &a ) { m_attr_widgets = a; m_has_attr_widgets = true; }
+    inline void clearAttributeWidgets() { m_has_attr_widgets = false; }
+
+    inline bool hasAttributeApply() const { return m_has_attr_apply; }
+    inline const QString &attributeApply() const { return m_attr_apply; }
+    inline void setAttributeApply( const QString &a ) { m_attr_apply = a; m_has_attr_apply = true; }
+    inline void clearAttributeApply() { m_has_attr_apply = false; }
+
+    inline bool hasAttributeShell() const { return m_has_attr_shell; }
+    inline const QString &attributeShell() const { return m_attr_shell; }
+    inline void setAttributeShell( const QString &a ) { m_attr_shell = a; m_has_attr_shell = true; }
+    inline void clearAttributeShell() { m_has_attr_shell = false; }
+
     // child element accessors
+    inline const QStringList &elementCommand() const { return m_command; }
+    void setElementCommand( const QStringList &a );
+
+    inline const QList< DomPipeline* > &elementPipeline() const { return m_pipeline; }
+    void setElementPipeline( const QList< DomPipeline* > &a );
+
 private:
     QString m_text;
     void clear( bool clear_all = true );
@@ -3678,12 +3734,128 @@ private:
     QString m_attr_action;
     bool m_has_attr_action;
 
+    QString m_attr_input;
+    bool m_has_attr_input;
+
+    QString m_attr_widgets;
+    bool m_has_attr_widgets;
+
+    QString m_attr_apply;
+    bool m_has_attr_apply;
+
+    QString m_attr_shell;
+    bool m_has_attr_shell;
+
     // child element data
+    QStringList m_command;
+    QList< DomPipeline* > m_pipeline;
     uint m_children;
+    enum Child {
+        Command = 1,
+        Pipeline = 2
+    };
 
     DomEvent( const DomEvent &other );
     void operator = ( const DomEvent &other );
 };
+
+class QDESIGNER_UILIB_EXPORT DomSelect {
+public:
+    DomSelect();
+    ~DomSelect();
+
+    void read( QXmlStreamReader &reader );
+#ifdef QUILOADER_QDOM_READ
+    void read( const QDomElement &node );
+#endif
+    void write( QXmlStreamWriter &writer, const QString &tagName = QString() ) const;
+    inline const QString &text() const { return m_text; }
+    inline void setText( const QString &s ) { m_text = s; }
+
+    // attribute accessors
+    inline bool hasAttributeClass() const { return m_has_attr_class; }
+    inline const QString &attributeClass() const { return m_attr_class; }
+    inline void setAttributeClass( const QString &a ) { m_attr_class = a; m_has_attr_class = true; }
+    inline void clearAttributeClass() { m_has_attr_class = false; }
+
+    inline bool hasAttributeMatch() const { return m_has_attr_match; }
+    inline const QString &attributeMatch() const { return m_attr_match; }
+    inline void setAttributeMatch( const QString &a ) { m_attr_match = a; m_has_attr_match = true; }
+    inline void clearAttributeMatch() { m_has_attr_match = false; }
+
+    inline bool hasAttributeParent() const { return m_has_attr_parent; }
+    inline const QString &attributeParent() const { return m_attr_parent; }
+    inline void setAttributeParent( const QString &a ) { m_attr_parent = a; m_has_attr_parent = true; }
+    inline void clearAttributeParent() { m_has_attr_parent = false; }
+
+    inline bool hasAttributeProperty() const { return m_has_attr_property; }
+    inline const QString &attributeProperty() const { return m_attr_property; }
+    inline void setAttributeProperty( const QString &a ) { m_attr_property = a; m_has_attr_property = true; }
+    inline void clearAttributeProperty() { m_has_attr_property = false; }
+
+    // child element accessors
+    inline const QList< DomProperty* > &elementProperty() const { return m_property; }
+    void setElementProperty( const QList< DomProperty* > &a );
+
+private:
+    QString m_text;
+    void clear( bool clear_all = true );
+
+    // attribute data
+    QString m_attr_class;
+    bool m_has_attr_class;
+
+    QString m_attr_match;
+    bool m_has_attr_match;
+
+    QString m_attr_parent;
+    bool m_has_attr_parent;
+
+    QString m_attr_property;
+    bool m_has_attr_property;
+
+    // child element data
+    QList< DomProperty* > m_property;
+    uint m_children;
+    enum Child {
+        Property = 1
+    };
+
+    DomSelect( const DomSelect &other );
+    void operator = ( const DomSelect &other );
+};
+
+class QDESIGNER_UILIB_EXPORT DomPipeline {
+public:
+    DomPipeline();
+    ~DomPipeline();
+
+    void read( QXmlStreamReader &reader );
+#ifdef QUILOADER_QDOM_READ
+    void read( const QDomElement &node );
+#endif
+    void write( QXmlStreamWriter &writer, const QString &tagName = QString() ) const;
+    inline const QString &text() const { return m_text; }
+    inline void setText( const QString &s ) { m_text = s; }
+
+    // child element accessors
+    inline const QStringList &elementStage() const { return m_stage; }
+    void setElementStage( const QStringList &a );
+
+private:
+    QString m_text;
+    void clear( bool clear_all = true );
+
+    // child element data
+    QStringList m_stage;
+    uint m_children;
+    enum Child {
+        Stage = 1
+    };
+
+    DomPipeline( const DomPipeline &other );
+    void operator = ( const DomPipeline &other );
+};
 // END: Val
 
 class QDESIGNER_UILIB_EXPORT DomScript {
@@ -3696,17 +3868,17 @@ public:
     void read(const QDomElement &node);
 #endif
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
-    inline QString text() const { return m_text; }
+    inline const QString &text() const { return m_text; }
     inline void setText(const QString &s) { m_text = s; }
 
     // attribute accessors
     inline bool hasAttributeSource() const { return m_has_attr_source; }
-    inline QString attributeSource() const { return m_attr_source; }
+    inline const QString &attributeSource() const { return m_attr_source; }
     inline void setAttributeSource(const QString& a) { m_attr_source = a; m_has_attr_source = true; }
     inline void clearAttributeSource() { m_has_attr_source = false; }
 
     inline bool hasAttributeLanguage() const { return m_has_attr_language; }
-    inline QString attributeLanguage() const { return m_attr_language; }
+    inline const QString &attributeLanguage() const { return m_attr_language; }
     inline void setAttributeLanguage(const QString& a) { m_attr_language = a; m_has_attr_language = true; }
     inline void clearAttributeLanguage() { m_has_attr_language = false; }
 
@@ -3739,12 +3911,12 @@ public:
     void read(const QDomElement &node);
 #endif
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
-    inline QString text() const { return m_text; }
+    inline const QString &text() const { return m_text; }
     inline void setText(const QString &s) { m_text = s; }
 
     // attribute accessors
     // child element accessors
-    inline QList<DomProperty*> elementProperty() const { return m_property; }
+    inline const QList<DomProperty*> &elementProperty() const { return m_property; }
     void setElementProperty(const QList<DomProperty*>& a);
 
 private:
@@ -3773,12 +3945,12 @@ public:
     void read(const QDomElement &node);
 #endif
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
-    inline QString text() const { return m_text; }
+    inline const QString &text() const { return m_text; }
     inline void setText(const QString &s) { m_text = s; }
 
     // attribute accessors
     // child element accessors
-    inline QList<DomProperty*> elementProperty() const { return m_property; }
+    inline const QList<DomProperty*> &elementProperty() const { return m_property; }
     void setElementProperty(const QList<DomProperty*>& a);
 
 private:
@@ -3807,15 +3979,15 @@ public:
     void read(const QDomElement &node);
 #endif
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
-    inline QString text() const { return m_text; }
+    inline const QString &text() const { return m_text; }
     inline void setText(const QString &s) { m_text = s; }
 
     // attribute accessors
     // child element accessors
-    inline QStringList elementSignal() const { return m_signal; }
+    inline const QStringList &elementSignal() const { return m_signal; }
     void setElementSignal(const QStringList& a);
 
-    inline QStringList elementSlot() const { return m_slot; }
+    inline const QStringList &elementSlot() const { return m_slot; }
     void setElementSlot(const QStringList& a);
 
 private:
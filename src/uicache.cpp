@@ -0,0 +1,260 @@
+/**
+ * VaL::bOK <valbok@gmail.com>
+ * Created on: <10-Jun-2009 11:00:54 VaL>
+ *
+ * COPYRIGHT NOTICE: Copyright (C) 2009 VaL::bOK
+ * SOFTWARE LICENSE: GNU General Public License v2.0
+ */
+
+#include "uicache.h"
+#include <QtCore/QCryptographicHash>
+#include <QtCore/QDateTime>
+#include <QtCore/QFileInfo>
+#include <QtCore/QDir>
+#include <QtCore/QTextStream>
+#include <stdio.h>
+
+using namespace OpenForm;
+
+/**
+ * Version of cache format, cached files of other versions are ignored
+ */
+static const char *CACHE_VERSION = "openform-cache 2";
+
+/**
+ * Size of data that is read at once to compute hash of a file
+ */
+static const int HASH_BLOCK_SIZE = 65536;
+
+UiCache::UiCache( const QString &fileName ): FileName( QFileInfo( fileName ).absoluteFilePath() )
+{
+    QByteArray hash = QCryptographicHash::hash( this->FileName.toUtf8(), QCryptographicHash::Sha1 ).toHex();
+    this->CacheName = UiCache::cacheDir() + QDir::separator() + QString::fromLatin1( hash );
+}
+
+/**
+ * Returns directory where cached files are stored
+ */
+QString UiCache::cacheDir()
+{
+    QString dir = QString::fromLocal8Bit( qgetenv( "XDG_CACHE_HOME" ) );
+    if ( dir.isEmpty() )
+    {
+        dir = QDir::homePath() + QDir::separator() + ".cache";
+    }
+
+    return dir + QDir::separator() + "openform";
+}
+
+/**
+ * Returns dependency line for \a fileName: SHA-1 hash of content and name of the file.
+ * Missing files are stored too, so creating them invalidates the cache.
+ */
+QString UiCache::dependency( const QString &fileName )
+{
+    QFile file( fileName );
+    if ( !file.open( QFile::ReadOnly ) )
+    {
+        return "- " + fileName;
+    }
+
+    // Modification time is not enough, it has one second resolution and the file might keep its size
+    QCryptographicHash hash( QCryptographicHash::Sha1 );
+    while ( !file.atEnd() )
+    {
+        const QByteArray block = file.read( HASH_BLOCK_SIZE );
+        if ( block.isEmpty() )
+        {
+            return "- " + fileName;
+        }
+
+        hash.addData( block );
+    }
+
+    return QString::fromLatin1( hash.result().toHex() ) + " " + fileName;
+}
+
+/**
+ * Checks if \a fileName is modified since \a time, missing file is not modified.
+ * Modification time has one second resolution, so the file is modified if it is changed in the same second.
+ */
+static bool isModifiedSince( const QString &fileName, const QDateTime &time )
+{
+    QFileInfo info( fileName );
+    return info.exists() && info.lastModified().toTime_t() >= time.toTime_t();
+}
+
+/**
+ * Checks if cached document exists and none of its dependencies is changed
+ */
+bool UiCache::isValid() const
+{
+    QFile deps( this->CacheName + ".deps" );
+    if ( !deps.open( QFile::ReadOnly | QFile::Text ) )
+    {
+        return false;
+    }
+
+    QTextStream stream( &deps );
+    stream.setCodec( "UTF-8" );
+
+    if ( stream.readLine() != CACHE_VERSION )
+    {
+        return false;
+    }
+
+    // The first dependency is always the UI file itself
+    bool found = false;
+    while ( !stream.atEnd() )
+    {
+        QString line = stream.readLine();
+        if ( line.isEmpty() )
+        {
+            continue;
+        }
+
+        QString fileName = line.section( ' ', 1 );
+        if ( !found && fileName != this->FileName )
+        {
+            return false;
+        }
+
+        found = true;
+        if ( line != UiCache::dependency( fileName ) )
+        {
+            return false;
+        }
+    }
+
+    return found;
+}
+
+/**
+ * Opens cached document if it is valid.
+ * Returns device to read the document from or 0 if the cache could not be used
+ */
+QIODevice *UiCache::load()
+{
+    if ( !this->isValid() )
+    {
+        return 0;
+    }
+
+    this->Document.setFileName( this->CacheName + ".ui" );
+    if ( !this->Document.open( QFile::ReadOnly ) )
+    {
+        return 0;
+    }
+
+    return &this->Document;
+}
+
+/**
+ * Replaces \a fileName by temporary \a file atomically, so other processes never see incomplete file
+ */
+static bool replaceFile( QTemporaryFile &file, const QString &fileName )
+{
+    file.close();
+    if ( ::rename( QFile::encodeName( file.fileName() ).constData(), QFile::encodeName( fileName ).constData() ) != 0 )
+    {
+        return false;
+    }
+
+    file.setAutoRemove( false );
+
+    return true;
+}
+
+/**
+ * Creates new cached document under unique name, so several processes can fill the same cache.
+ * Returns device to write the document to or 0 if the cache could not be created
+ */
+QIODevice *UiCache::create()
+{
+    this->Document.close();
+    this->Created.reset();
+
+    if ( !QDir().mkpath( UiCache::cacheDir() ) )
+    {
+        return 0;
+    }
+
+    this->CreatedTime = QDateTime::currentDateTime();
+    this->Created.reset( new QTemporaryFile( this->CacheName + ".ui.XXXXXX" ) );
+    if ( !this->Created->open() )
+    {
+        this->Created.reset();
+        return 0;
+    }
+
+    return this->Created.data();
+}
+
+/**
+ * Stores created document with \a dependencies of the UI file.
+ * Returns false if it is not stored, e.g. when the UI file or its dependencies are modified since the document is created.
+ */
+bool UiCache::save( const QStringList &dependencies )
+{
+    if ( !this->Created )
+    {
+        return false;
+    }
+
+    // Hashes are computed before checking modification time, so a file changed after the check
+    // gets a hash that does not match it anymore and invalidates the cache next time
+    const QStringList fileNames = QStringList() << this->FileName << dependencies;
+    QStringList lines;
+    for ( int i = 0; i < fileNames.size(); ++i )
+    {
+        lines.append( UiCache::dependency( fileNames.at( i ) ) );
+    }
+
+    // Files could be changed while they have been read, so the hashes might not match the document
+    for ( int i = 0; i < fileNames.size(); ++i )
+    {
+        if ( isModifiedSince( fileNames.at( i ), this->CreatedTime ) )
+        {
+            this->Created.reset();
+            return false;
+        }
+    }
+
+    // Old dependencies should not refer to new document until it is stored completely
+    QString depsName = this->CacheName + ".deps";
+    QFile::remove( depsName );
+
+    bool stored = replaceFile( *this->Created, this->CacheName + ".ui" );
+    this->Created.reset();
+    if ( !stored )
+    {
+        return false;
+    }
+
+    QTemporaryFile deps( depsName + ".XXXXXX" );
+    if ( !deps.open() )
+    {
+        return false;
+    }
+
+    QTextStream stream( &deps );
+    stream.setCodec( "UTF-8" );
+    stream << CACHE_VERSION << "\n";
+    for ( int i = 0; i < lines.size(); ++i )
+    {
+        stream << lines.at( i ) << "\n";
+    }
+
+    stream.flush();
+
+    return replaceFile( deps, depsName );
+}
+
+/**
+ * Closes cached document, removes it if it has been created but not saved
+ */
+void UiCache::discard()
+{
+    this->Document.close();
+    this->Created.reset();
+}
@@ -0,0 +1,77 @@
+/**
+ * VaL::bOK <valbok@gmail.com>
+ * Created on: <10-Jun-2009 11:00:54 VaL>
+ *
+ * COPYRIGHT NOTICE: Copyright (C) 2009 VaL::bOK
+ * SOFTWARE LICENSE: GNU General Public License v2.0
+ */
+
+#ifndef UICACHE_H
+#define UICACHE_H
+
+#include <QtCore/QDateTime>
+#include <QtCore/QFile>
+#include <QtCore/QScopedPointer>
+#include <QtCore/QTemporaryFile>
+#include <QtCore/QString>
+#include <QtCore/QStringList>
+
+namespace OpenForm
+{
+
+/**
+ * This class contains methods to store preprocessed UI on disk.
+ *
+ * Cached UI consists of two files in cache directory named by hash of UI file name:
+ *   <hash>.ui   - preprocessed document with resolved includes and without comments
+ *   <hash>.deps - list of files the document depends on with SHA-1 hashes of their content
+ *
+ * The cache is valid while content of none of the files is changed.
+ * Document is not saved if any of the files is modified while it is being created,
+ * because it is not known which version of the file has been read.
+ */
+class UiCache
+{
+    /**
+     * Absolute name of UI file
+     */
+    QString FileName;
+
+    /**
+     * Name of cached files without extension
+     */
+    QString CacheName;
+
+    /**
+     * Cached document that is being read
+     */
+    QFile Document;
+
+    /**
+     * Document that is being written under unique name, it is renamed to cached document when it is saved
+     */
+    QScopedPointer< QTemporaryFile > Created;
+
+    /**
+     * Time when creating of the document is started
+     */
+    QDateTime CreatedTime;
+
+    bool isValid() const;
+    static QString dependency( const QString &fileName );
+
+public:
+    UiCache( const QString &fileName );
+    ~UiCache() {}
+
+    QIODevice *load();
+    QIODevice *create();
+    bool save( const QStringList &dependencies );
+    void discard();
+
+    static QString cacheDir();
+};
+
+} // namespace OpenForm
+
+#endif // UICACHE_H
@@ -0,0 +1,135 @@
+/**
+ * VaL::bOK <valbok@gmail.com>
+ * Created on: <10-Jun-2009 11:00:54 VaL>
+ *
+ * COPYRIGHT NOTICE: Copyright (C) 2009 VaL::bOK
+ * SOFTWARE LICENSE: GNU General Public License v2.0
+ */
+
+#include "uiclient.h"
+#include "uiserver.h"
+#include <QtCore/QDataStream>
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QProcess>
+#include <QtNetwork/QLocalSocket>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace OpenForm;
+
+/**
+ * Time in msecs to wait for connection to daemon
+ */
+static const int CONNECT_TIMEOUT = 1000;
+
+/**
+ * Checks if daemon socket of the user exists, it does not need any application instance
+ */
+bool UiClient::isDaemonRunning()
+{
+    const QString name = UiServer::serverName();
+    if ( name.isEmpty() )
+    {
+        return false;
+    }
+
+    struct stat info;
+    if ( ::lstat( QFile::encodeName( name ).constData(), &info ) != 0 )
+    {
+        return false;
+    }
+
+    return S_ISSOCK( info.st_mode ) && info.st_uid == ::getuid();
+}
+
+/**
+ * Sends UI file \a fileName ( or stdin if it is empty ) to daemon and waits until the form is closed.
+ * Output of the form is written to stdout and stderr, \a exitCode is set to exit code of the form.
+ *
+ * Returns false if daemon is not available, so the form should be shown by current process.
+ */
+bool UiClient::run( const QString &fileName, bool useCache, int *exitCode )
+{
+    QLocalSocket socket;
+    socket.connectToServer( UiServer::serverName() );
+    if ( !socket.waitForConnected( CONNECT_TIMEOUT ) )
+    {
+        return false;
+    }
+
+    // Form, stdin and output must not be passed to process of other user
+    if ( !UiServer::isPeerTrusted( &socket ) )
+    {
+        fprintf( stderr, "Open Form daemon is run by other user, it is not used\n" );
+        return false;
+    }
+
+    QByteArray input;
+    if ( fileName.isEmpty() )
+    {
+        QFile in;
+        in.open( stdin, QIODevice::ReadOnly );
+        input = in.readAll();
+    }
+
+    QByteArray request;
+    QDataStream requestStream( &request, QIODevice::WriteOnly );
+    requestStream << quint32( 0 ) << Daemon::PROTOCOL << QDir::currentPath() << fileName << input << useCache << QProcess::systemEnvironment();
+    requestStream.device()->seek( 0 );
+    requestStream << quint32( request.size() - sizeof( quint32 ) );
+
+    socket.write( request );
+    while ( socket.bytesToWrite() > 0 && socket.waitForBytesWritten( -1 ) )
+    {
+    }
+
+    QDataStream stream( &socket );
+    qint64 frameSize = -1;
+    forever
+    {
+        if ( frameSize < 0 && socket.bytesAvailable() >= (qint64) sizeof( quint32 ) )
+        {
+            quint32 size = 0;
+            stream >> size;
+            frameSize = size;
+        }
+
+        if ( frameSize < 0 || socket.bytesAvailable() < frameSize )
+        {
+            if ( !socket.waitForReadyRead( -1 ) )
+            {
+                break;
+            }
+
+            continue;
+        }
+
+        const QByteArray frame = socket.read( frameSize );
+        QDataStream frameStream( frame );
+        quint8 type = 0;
+        QByteArray data;
+        frameStream >> type >> data;
+        frameSize = -1;
+
+        if ( type == Daemon::OUTPUT )
+        {
+            fwrite( data.constData(), 1, data.size(), stdout );
+            fflush( stdout );
+        }
+        else if ( type == Daemon::ERROR_OUTPUT )
+        {
+            fwrite( data.constData(), 1, data.size(), stderr );
+        }
+        else if ( type == Daemon::EXIT )
+        {
+            *exitCode = data.toInt();
+            return true;
+        }
+    }
+
+    fprintf( stderr, "Connection to Open Form daemon is lost\n" );
+    *exitCode = 4;
+
+    return true;
+}
@@ -0,0 +1,31 @@
+/**
+ * VaL::bOK <valbok@gmail.com>
+ * Created on: <10-Jun-2009 11:00:54 VaL>
+ *
+ * COPYRIGHT NOTICE: Copyright (C) 2009 VaL::bOK
+ * SOFTWARE LICENSE: GNU General Public License v2.0
+ */
+
+#ifndef UICLIENT_H
+#define UICLIENT_H
+
+#include <QtCore/QString>
+
+namespace OpenForm
+{
+
+/**
+ * This class contains methods to show a form by running daemon instead of initializing GUI.
+ *
+ * @sa UiServer
+ */
+class UiClient
+{
+public:
+    static bool isDaemonRunning();
+    static bool run( const QString &fileName, bool useCache, int *exitCode );
+};
+
+} // namespace OpenForm
+
+#endif // UICLIENT_H
@@ -0,0 +1,140 @@
+/**
+ * VaL::bOK <valbok@gmail.com>
+ * Created on: <10-Jun-2009 11:00:54 VaL>
+ *
+ * COPYRIGHT NOTICE: Copyright (C) 2009 VaL::bOK
+ * SOFTWARE LICENSE: GNU General Public License v2.0
+ */
+
+#include "uicontrol.h"
+#include "uiserver.h"
+#include "windowhandler.h"
+#include "inputcommandparser.h"
+
+using namespace OpenForm;
+
+UiControl::UiControl( WindowHandler *window, QObject *parent ): QObject( parent ), Window( window )
+{
+    connect( &this->Server, SIGNAL( newConnection() ), this, SLOT( newConnection() ) );
+    connect( this->Window, SIGNAL( updatesApplied() ), this, SLOT( answerPendingQueries() ) );
+}
+
+/**
+ * Starts listening for clients on socket \a name
+ */
+bool UiControl::listen( const QString &name )
+{
+    return UiServer::listen( this->Server, name );
+}
+
+/**
+ * Accepts new clients, clients of other users are disconnected as they could run commands by documents
+ */
+void UiControl::newConnection()
+{
+    while ( this->Server.hasPendingConnections() )
+    {
+        QLocalSocket *socket = this->Server.nextPendingConnection();
+        if ( !UiServer::isPeerTrusted( socket ) )
+        {
+            fprintf( stderr, "Connection of other user is rejected\n" );
+            socket->abort();
+            socket->deleteLater();
+            continue;
+        }
+
+        this->Splitters.insert( socket, DocumentSplitter() );
+
+        connect( socket, SIGNAL( readyRead() ), this, SLOT( readData() ) );
+        connect( socket, SIGNAL( disconnected() ), this, SLOT( disconnected() ) );
+    }
+}
+
+/**
+ * Applies received documents and answers queries
+ */
+void UiControl::readData()
+{
+    QLocalSocket *socket = qobject_cast< QLocalSocket* >( this->sender() );
+    if ( !socket || !this->Splitters.contains( socket ) )
+    {
+        return;
+    }
+
+    this->Splitters[socket].append( socket->readAll() );
+    this->handleData( socket );
+}
+
+/**
+ * Applies documents and answers queries received from \a socket.
+ * Handling is stopped by a query that should wait until previous documents are applied.
+ */
+void UiControl::handleData( QLocalSocket *socket )
+{
+    DocumentSplitter &splitter = this->Splitters[socket];
+
+    DocumentSplitter::ItemType type;
+    QByteArray item;
+    while ( !this->PendingQueries.contains( socket ) && splitter.next( &type, &item ) )
+    {
+        if ( type == DocumentSplitter::Document )
+        {
+            this->Window->setUiFrom( QString::fromUtf8( item.constData(), item.size() ) );
+            continue;
+        }
+
+        // Documents are parsed in worker thread and applied later
+        if ( this->Window->hasPendingUpdates() )
+        {
+            this->PendingQueries.insert( socket, item );
+            return;
+        }
+
+        this->answer( socket, item );
+    }
+}
+
+/**
+ * Writes result of \a query to \a socket
+ */
+void UiControl::answer( QLocalSocket *socket, const QByteArray &query )
+{
+    InputCommandParser parser( this->Window->getWidget() );
+    socket->write( parser.parse( QString::fromUtf8( query.constData(), query.size() ) ).toUtf8() + '\n' );
+}
+
+/**
+ * Answers queries that wait for applied documents and continues handling data of their clients
+ */
+void UiControl::answerPendingQueries()
+{
+    const QList< QLocalSocket* > sockets = this->PendingQueries.keys();
+    for ( int i = 0; i < sockets.size(); ++i )
+    {
+        // Resumed client might send new documents, other clients wait for them
+        if ( this->Window->hasPendingUpdates() )
+        {
+            return;
+        }
+
+        QLocalSocket *socket = sockets.at( i );
+        this->answer( socket, this->PendingQueries.take( socket ) );
+        this->handleData( socket );
+    }
+}
+
+/**
+ * Forgets disconnected client
+ */
+void UiControl::disconnected()
+{
+    QLocalSocket *socket = qobject_cast< QLocalSocket* >( this->sender() );
+    if ( !socket )
+    {
+        return;
+    }
+
+    this->Splitters.remove( socket );
+    this->PendingQueries.remove( socket );
+    socket->deleteLater();
+}
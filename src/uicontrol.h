@@ -0,0 +1,70 @@
+/**
+ * VaL::bOK <valbok@gmail.com>
+ * Created on: <10-Jun-2009 11:00:54 VaL>
+ *
+ * COPYRIGHT NOTICE: Copyright (C) 2009 VaL::bOK
+ * SOFTWARE LICENSE: GNU General Public License v2.0
+ */
+
+#ifndef UICONTROL_H
+#define UICONTROL_H
+
+#include <QtCore/QObject>
+#include <QtCore/QHash>
+#include <QtNetwork/QLocalServer>
+#include <QtNetwork/QLocalSocket>
+#include "documentsplitter.h"
+
+namespace OpenForm
+{
+
+class WindowHandler;
+
+/**
+ * This class contains methods to control running form by local clients.
+ *
+ * Clients write <ui> or <update> documents that are applied like documents returned by triggers,
+ * and queries like "?{edit.text}" each on its own line that are answered by one line with the result.
+ * Queries are answered when documents received before them are applied.
+ */
+class UiControl: public QObject
+{
+    Q_OBJECT
+
+    /**
+     * Form that is controlled
+     */
+    WindowHandler *Window;
+
+    QLocalServer Server;
+
+    /**
+     * Data received from each client
+     */
+    QHash< QLocalSocket*, DocumentSplitter > Splitters;
+
+    /**
+     * Query of each client that waits until previously received documents are applied,
+     * next data of the client is not handled until the query is answered
+     */
+    QHash< QLocalSocket*, QByteArray > PendingQueries;
+
+    void handleData( QLocalSocket *socket );
+    void answer( QLocalSocket *socket, const QByteArray &query );
+
+private slots:
+    void newConnection();
+    void readData();
+    void answerPendingQueries();
+    void disconnected();
+
+public:
+    UiControl( WindowHandler *window, QObject *parent = 0 );
+    ~UiControl() {}
+
+    bool listen( const QString &name );
+};
+
+} // namespace OpenForm
+
+#endif // UICONTROL_H
@@ -11,7 +11,13 @@
 
 using namespace OpenForm;
 
-UiLoader::TriggerListMap UiLoader::TriggerList;
+/**
+ * Relative resources like icons are searched in working directory of \a window
+ */
+UiLoader::UiLoader( WindowHandler *window ): QFormBuilder(), WinHandler( window ), Updating( false )
+{
+    this->setWorkingDirectory( QDir( window->getWorkingDirectory() ) );
+}
 
 /**
  * Searches object by name
@@ -25,59 +31,6 @@ QObject *UiLoader::objectByName( QWidget *topLevel, const QString &name )
     return qFindChild< QObject* >( topLevel, name );
 }
 
-/**
- * Deletes all existing triggers
- */
-void UiLoader::deleteTriggers()
-{
-    QList< TriggerMap > triggerItems = UiLoader::TriggerList.values();
-    for ( int i = 0; i < triggerItems.size(); i++ )
-    {
-        QList< Trigger* > triggers = triggerItems[i].values();
-        qDeleteAll( triggers );
-    }
-
-    UiLoader::TriggerList.clear();
-}
-
-/**
- * Deletes all trggers for object with \a objectName
- */
-void UiLoader::deleteTriggers( const QString &objectName )
-{
-    if ( !UiLoader::TriggerList.contains( objectName ) )
-    {
-        return;
-    }
-
-    TriggerMap triggerItems = UiLoader::TriggerList[objectName];
-    QList < Trigger* > triggers = triggerItems.values();
-    qDeleteAll( triggers );
-    UiLoader::TriggerList.remove( objectName );
-}
-
-/**
- * Deletes triggers by \a objectName and its \a signalName
- */
-void UiLoader::deleteTriggers( const QString &objectName, const QString &signalName )
-{
-    if ( !UiLoader::TriggerList.contains( objectName ) )
-    {
-        return;
-    }
-
-    TriggerMap *triggerItems = &UiLoader::TriggerList[objectName];
-
-    if ( !triggerItems->contains( signalName ) )
-    {
-        return;
-    }
-
-    delete (*triggerItems)[signalName];
-    triggerItems->remove( signalName );
-}
-
-
 /**
  * Parses triggers and install it for \a widget
  */
@@ -89,7 +42,6 @@ void UiLoader::createTriggers( DomTriggers *ui_triggers, QWidget *widget )
     }
 
     typedef QList< DomTrigger* > DomTriggerList;
-    typedef QList< DomEvent* > DomEventList;
 
     Q_ASSERT( widget != 0 );
 
@@ -110,72 +62,215 @@ void UiLoader::createTriggers( DomTriggers *ui_triggers, QWidget *widget )
     const DomTriggerList::const_iterator cend = triggers.constEnd();
     for ( DomTriggerList::const_iterator it = triggers.constBegin(); it != cend; ++it )
     {
-        QString objectName = (*it)->attributeObject();
+        const QList< DomEvent* > events = (*it)->elementEvent();
+        if ( events.empty() )
+        {
+            continue;
+        }
+
+        QList< QObject* > objects;
+        if ( !(*it)->attributeObject().isEmpty() )
+        {
+            QString objectName = (*it)->attributeObject();
+            QObject *object = UiLoader::objectByName( widget, objectName );
+            if ( !object )
+            {
+                fprintf( stderr, "Trigger could not find object by name '%s'\n", objectName.toLocal8Bit().constData() );
+                continue;
+            }
+
+            objects.append( object );
+        }
+        else if ( (*it)->hasAttributeClass() || (*it)->hasAttributeMatch() || (*it)->hasAttributeProperty() )
+        {
+            objects = UiLoader::selectObjects( widget, (*it)->attributeClass(), (*it)->attributeMatch(), (*it)->attributeProperty() );
+        }
+        else
+        {
+            fprintf( stderr, "Attribute \"object\" or a selector is required for a trigger\n" );
+            continue;
+        }
+
+        // Triggers are installed by object name, so only the first of objects with the same name gets them
+        QSet< QString > names;
+        for ( int i = 0; i < objects.size(); ++i )
+        {
+            const QString objectName = objects.at( i )->objectName();
+            if ( names.contains( objectName ) )
+            {
+                fprintf( stderr, "Trigger is skipped for object with duplicated name '%s'\n", objectName.toLocal8Bit().constData() );
+                continue;
+            }
 
-        if ( objectName.isEmpty() )
+            names.insert( objectName );
+            this->createEvents( objects.at( i ), events, &triggerList );
+        }
+    }
+}
+
+/**
+ * Returns named objects of \a widget and its children matched by all not empty selectors,
+ * internal children of Qt widgets like "qt_spinbox_lineedit" are skipped:
+ *   \a className - objects that inherit the class like "QPushButton"
+ *   \a match     - objects with names matched by wildcard like "btn*"
+ *   \a property  - objects with dynamic or static property like "digit", or with property value like "digit=1"
+ */
+QList< QObject* > UiLoader::selectObjects( QWidget *widget, const QString &className, const QString &match, const QString &property )
+{
+    const QByteArray classKey = className.toUtf8();
+    const QRegExp nameMatch( match, Qt::CaseSensitive, QRegExp::Wildcard );
+
+    const int separator = property.indexOf( '=' );
+    const QByteArray propertyName = ( separator < 0 ? property : property.left( separator ) ).trimmed().toUtf8();
+    const QString propertyValue = separator < 0 ? QString() : property.mid( separator + 1 ).trimmed();
+
+    QList< QObject* > candidates = widget->findChildren< QObject* >();
+    candidates.prepend( widget );
+
+    QList< QObject* > result;
+    for ( int i = 0; i < candidates.size(); ++i )
+    {
+        QObject *object = candidates.at( i );
+        if ( object->objectName().isEmpty() || object->objectName().startsWith( "qt_" ) )
         {
-            fprintf( stderr, "Attribute \"object\" is required for a trigger\n" );
             continue;
         }
 
-        QObject *object = UiLoader::objectByName( widget, objectName );
-        if ( !object )
+        if ( !className.isEmpty() && !object->inherits( classKey.constData() ) )
         {
-            fprintf( stderr, "Trigger could not find object by name '%s'\n", objectName.toLocal8Bit().constData() );
             continue;
         }
 
-        const DomEventList events = (*it)->elementEvent();
-        if ( events.empty() )
+        if ( !match.isEmpty() && !nameMatch.exactMatch( object->objectName() ) )
         {
             continue;
         }
 
-        const DomEventList::const_iterator cEventEnd = events.constEnd();
-        for ( DomEventList::const_iterator eventIt = events.constBegin(); eventIt != cEventEnd; ++eventIt )
+        if ( !property.isEmpty() )
         {
-            QString command = (*eventIt)->text();
-            QString sig = (*eventIt)->attributeSignal().simplified();
-            if ( command.isEmpty() || sig.isEmpty() )
+            const QVariant value = object->property( propertyName.constData() );
+            if ( !value.isValid() || ( separator >= 0 && value.toString() != propertyValue ) )
             {
                 continue;
             }
+        }
 
-            // Skip all whitespaces in signal
-            // It needs to allow to use signal names without brackets
-            QString signalName;
-            for ( int i = 0; i < sig.length(); i++ )
-            {
-                if ( sig[i].isSpace() )
-                {
-                    continue;
-                }
+        result.append( object );
+    }
 
-                signalName += sig[i];
-            }
+    return result;
+}
 
-            // Add brackets if needed
-            if ( signalName.right( 2 ) != "()" )
+/**
+ * Applies properties of \a selects to all matched objects of \a widget.
+ * The subtree is limited by attribute "parent" if provided.
+ */
+void UiLoader::applySelects( const QList< DomSelect* > &selects, QWidget *widget )
+{
+    for ( int i = 0; i < selects.size(); ++i )
+    {
+        const DomSelect *ui_select = selects.at( i );
+        QWidget *root = widget;
+        if ( ui_select->hasAttributeParent() )
+        {
+            root = qobject_cast< QWidget* >( UiLoader::objectByName( widget, ui_select->attributeParent() ) );
+            if ( !root )
             {
-                signalName += "()";
+                fprintf( stderr, "Select could not find widget by name '%s'\n", ui_select->attributeParent().toLocal8Bit().constData() );
+                continue;
             }
+        }
+
+        const QList< QObject* > objects = UiLoader::selectObjects( root, ui_select->attributeClass(), ui_select->attributeMatch(), ui_select->attributeProperty() );
+        for ( int j = 0; j < objects.size(); ++j )
+        {
+            this->applyProperties( objects.at( j ), ui_select->elementProperty() );
+        }
+    }
+}
+
+/**
+ * Creates triggers of \a events for \a object.
+ * \a triggerList contains already defined triggers and their commands.
+ */
+void UiLoader::createEvents( QObject *object, const QList< DomEvent* > &events, QMap< QString, QString > *triggerList )
+{
+    typedef QList< DomEvent* > DomEventList;
+
+    const QString objectName = object->objectName();
+    const DomEventList::const_iterator cEventEnd = events.constEnd();
+    for ( DomEventList::const_iterator eventIt = events.constBegin(); eventIt != cEventEnd; ++eventIt )
+    {
+        // Command can be defined as text of event or as several <command> elements
+        QStringList commands = (*eventIt)->elementCommand();
+        if ( !(*eventIt)->text().isEmpty() )
+        {
+            commands.prepend( (*eventIt)->text() );
+        }
 
-            QString triggerKey = objectName + signalName;
+        QString command = commands.join( "; " );
+        QString sig = (*eventIt)->attributeSignal().simplified();
+        const QList< DomPipeline* > pipelines = (*eventIt)->elementPipeline();
+        if ( ( commands.isEmpty() && pipelines.isEmpty() ) || sig.isEmpty() )
+        {
+            continue;
+        }
 
-            if ( triggerList.contains( triggerKey ) )
+        // Skip all whitespaces in signal
+        // It needs to allow to use signal names without brackets
+        QString signalName;
+        for ( int i = 0; i < sig.length(); i++ )
+        {
+            if ( sig[i].isSpace() )
             {
-                fprintf( stderr, "%s::%s: Trigger already exists: '%s'\n", objectName.toLocal8Bit().constData(),
-                         signalName.toLocal8Bit().constData(), triggerList[triggerKey].toLocal8Bit().constData() );
                 continue;
             }
 
-            // Delete previous trigger for current object and signal
-            UiLoader::deleteTriggers( objectName, signalName );
+            signalName += sig[i];
+        }
+
+        // Add brackets if needed, signals with arguments like "valueChanged(int)" are kept as they are
+        if ( !signalName.contains( '(' ) )
+        {
+            signalName += "()";
+        }
+
+        signalName = QMetaObject::normalizedSignature( signalName.toUtf8().constData() );
 
-            UiLoader::TriggerList[objectName][signalName] = new Trigger( command, (*eventIt)->attributeAction(), object, this->WinHandler, signalName );
+        QString triggerKey = objectName + signalName;
 
-            triggerList[triggerKey] = command;
+        if ( triggerList->contains( triggerKey ) )
+        {
+            fprintf( stderr, "%s::%s: Trigger already exists: '%s'\n", objectName.toLocal8Bit().constData(),
+                     signalName.toLocal8Bit().constData(), triggerList->value( triggerKey ).toLocal8Bit().constData() );
+            continue;
+        }
+
+        Trigger trigger( commands, (*eventIt)->attributeAction(), objectName, signalName );
+        if ( (*eventIt)->hasAttributeInput() )
+        {
+            trigger.setInput( (*eventIt)->attributeInput(), (*eventIt)->attributeWidgets() );
+        }
+
+        if ( (*eventIt)->hasAttributeApply() )
+        {
+            trigger.setApply( (*eventIt)->attributeApply() );
+        }
+
+        if ( (*eventIt)->hasAttributeShell() )
+        {
+            trigger.setShell( (*eventIt)->attributeShell() );
         }
+
+        for ( int i = 0; i < pipelines.size(); ++i )
+        {
+            trigger.addPipeline( pipelines.at( i )->elementStage() );
+        }
+
+        // Previous trigger for current object and signal is deleted
+        this->WinHandler->setTrigger( object, objectName, signalName, trigger );
+
+        triggerList->insert( triggerKey, command );
     }
 }
 
@@ -193,6 +288,7 @@ QWidget *UiLoader::create( DomUI *ui, QWidget *parentWidget )
         // so need to handle triggers if provided.
         if ( this->Updating && this->WinHandler && this->WinHandler->hasUi() )
         {
+            this->applySelects( ui->elementSelect(), this->WinHandler->getWidget() );
             this->createTriggers( ui->elementTriggers(), this->WinHandler->getWidget() );
         }
 
@@ -214,6 +310,7 @@ QWidget *UiLoader::create( DomUI *ui, QWidget *parentWidget )
     QWidget *newWidget = this->Updating && this->WinHandler && this->WinHandler->hasUi() ? this->WinHandler->getWidget() : widget;
 
     this->createConnections( ui->elementConnections(), newWidget );
+    this->applySelects( ui->elementSelect(), newWidget );
     this->createTriggers( ui->elementTriggers(), newWidget );
     this->createResources( ui->elementResources() ); // maybe this should go first, before create()...
     this->applyTabStops( newWidget, ui->elementTabStops() );
@@ -257,6 +354,68 @@ QAction *UiLoader::createAction( QObject *parent, const QString &name )
     return dynamic_cast< QAction* > ( object );
 }
 
+/**
+ * Computes only one property \a name of \a obj instead of building dom for whole widget.
+ *
+ * Returns 0 if there is no such property or it could not be stored in dom.
+ */
+DomProperty *UiLoader::computeProperty( QObject *obj, const QString &name )
+{
+    const QMetaObject *meta = obj->metaObject();
+    const int index = meta->indexOfProperty( name.toUtf8() );
+    if ( index < 0 )
+    {
+        return 0;
+    }
+
+    const QMetaProperty prop = meta->property( index );
+    if ( !prop.isWritable() || !this->checkProperty( obj, name ) )
+    {
+        return 0;
+    }
+
+    const QVariant v = prop.read( obj );
+
+    DomProperty *dom_prop = 0;
+    if ( v.type() == QVariant::Int )
+    {
+        dom_prop = new DomProperty();
+
+        if ( prop.isEnumType() )
+        {
+            QString scope = QString::fromUtf8( prop.enumerator().scope() );
+            if ( scope.size() )
+            {
+                scope += QString::fromUtf8( "::" );
+            }
+
+            const QString e = QString::fromUtf8( prop.enumerator().valueToKey( v.toInt() ) );
+            if ( e.size() )
+            {
+                dom_prop->setElementEnum( scope + e );
+            }
+        }
+        else
+        {
+            dom_prop->setElementNumber( v.toInt() );
+        }
+
+        dom_prop->setAttributeName( name );
+    }
+    else
+    {
+        dom_prop = this->createProperty( obj, name, v );
+    }
+
+    if ( dom_prop && dom_prop->kind() == DomProperty::Unknown )
+    {
+        delete dom_prop;
+        return 0;
+    }
+
+    return dom_prop;
+}
+
 /**
  * Creates new DomTriggers
  */
@@ -311,9 +470,28 @@ QWidget *UiLoader::load( const QString &data, QWidget *parentWidget )
  */
 QWidget *UiLoader::load( QXmlStreamReader &reader, QWidget *parentWidget )
 {
-    DomUI ui;
+    bool isUpdate = false;
+    QScopedPointer< DomUI > ui( UiLoader::read( reader, &isUpdate ) );
+    if ( !ui )
+    {
+        return 0;
+    }
+
+    return this->load( ui.data(), isUpdate, parentWidget );
+}
+
+/**
+ * Parses UI document from QXmlStreamReader without creating any widgets,
+ * so it can be called outside of GUI thread.
+ *
+ * \a isUpdate is set to true if first element is <update>.
+ * Returns 0 on errors.
+ */
+DomUI *UiLoader::read( QXmlStreamReader &reader, bool *isUpdate )
+{
+    QScopedPointer< DomUI > ui( new DomUI );
     bool initialized = false;
-    this->Updating = false;
+    *isUpdate = false;
 
     const QString uiElement = QLatin1String( "ui" );
     const QString updateElement = QLatin1String( "update" );
@@ -323,24 +501,17 @@ QWidget *UiLoader::load( QXmlStreamReader &reader, QWidget *parentWidget )
         if ( reader.readNext() == QXmlStreamReader::StartElement )
         {
             // If first element is <update>
-            if ( this->WinHandler && reader.name().compare( updateElement, Qt::CaseInsensitive ) == 0 )
+            if ( reader.name().compare( updateElement, Qt::CaseInsensitive ) == 0 )
             {
-                // If there is no loaded UI
-                if ( !this->WinHandler->hasUi() )
-                {
-                    reader.raiseError( QCoreApplication::translate( "QAbstractFormBuilder", "No loaded user interface to update" ) );
-                    break;
-                }
-
-                ui.readUpdated( reader );
+                ui->readUpdated( reader );
                 initialized = true;
-                this->Updating = true;
+                *isUpdate = true;
             }
             else if ( reader.name().compare( uiElement, Qt::CaseInsensitive ) == 0 )
             {
-                ui.read( reader );
+                ui->read( reader );
                 initialized = true;
-                UiLoader::deleteTriggers();
+                *isUpdate = false;
             }
             else
             {
@@ -363,7 +534,40 @@ QWidget *UiLoader::load( QXmlStreamReader &reader, QWidget *parentWidget )
         return 0;
     }
 
-    QWidget *widget = this->create( &ui, parentWidget );
+    return ui.take();
+}
+
+/**
+ * Creates widget by already parsed \a ui, must be called in GUI thread.
+ *
+ * Returns Widget - if new GUI should be installed
+ *         0      - when just need to update current GUI
+ */
+QWidget *UiLoader::load( DomUI *ui, bool isUpdate, QWidget *parentWidget )
+{
+    this->Updating = isUpdate;
+
+    if ( isUpdate )
+    {
+        if ( !this->WinHandler )
+        {
+            qWarning( "%s", qPrintable( QCoreApplication::translate( "QAbstractFormBuilder", "Unexpected element <%1>" ).arg( "update" ) ) );
+            return 0;
+        }
+
+        // If there is no loaded UI
+        if ( !this->WinHandler->hasUi() )
+        {
+            qWarning( "%s", qPrintable( QCoreApplication::translate( "QAbstractFormBuilder", "No loaded user interface to update" ) ) );
+            return 0;
+        }
+    }
+    else if ( this->WinHandler )
+    {
+        this->WinHandler->deleteTriggers();
+    }
+
+    QWidget *widget = this->create( ui, parentWidget );
 
     // Need to return widget when new GUI is provided only
     return !this->Updating ? widget : 0;
@@ -23,23 +23,6 @@ namespace OpenForm
  */
 class UiLoader: public QFormBuilder
 {
-    /**
-     * @key   - Event name like "clicked()"
-     * @value - Trigger
-     */
-    typedef QMap< QString, Trigger* > TriggerMap;
-
-    /**
-     * @key   - Object name
-     * @value - Events for this object
-     */
-    typedef QMap< QString, TriggerMap > TriggerListMap;
-
-    /**
-     * List of triggers
-     */
-    static TriggerListMap TriggerList;
-
     /**
      * UI handler
      */
@@ -52,27 +35,30 @@ class UiLoader: public QFormBuilder
 
 public:
     UiLoader(): QFormBuilder(), WinHandler( 0 ), Updating( false ) {}
-    UiLoader( WindowHandler *window ): QFormBuilder(), WinHandler( window ), Updating( false ) {}
+    UiLoader( WindowHandler *window );
 
     static QObject *objectByName( QWidget *topLevel, const QString &name );
     QWidget *load( QXmlStreamReader &reader, QWidget *parentWidget = 0 );
     QWidget *load( const QString &data, QWidget *parentWidget = 0 );
     QWidget *load( QIODevice *dev, QWidget *parentWidget = 0 );
+    QWidget *load( DomUI *ui, bool isUpdate, QWidget *parentWidget = 0 );
+    static DomUI *read( QXmlStreamReader &reader, bool *isUpdate );
 
     // Allow InputCommandParser to use some protected functions
     friend class InputCommandParser;
 
 protected:
     virtual void createTriggers( DomTriggers *triggers, QWidget *widget );
+    void createEvents( QObject *object, const QList< DomEvent* > &events, QMap< QString, QString > *triggerList );
+    static QList< QObject* > selectObjects( QWidget *widget, const QString &className, const QString &match, const QString &property );
+    void applySelects( const QList< DomSelect* > &selects, QWidget *widget );
     virtual QWidget *create( DomUI *ui, QWidget *parentWidget );
     virtual QWidget *createWidget( const QString &widgetName, QWidget *parentWidget, const QString &name );
     virtual QAction *createAction( QObject *parent, const QString &name );
+    DomProperty *computeProperty( QObject *obj, const QString &name );
 
     DomTriggers *saveTriggers();
     virtual void saveDom( DomUI *ui, QWidget *widget );
-    static void deleteTriggers();
-    static void deleteTriggers( const QString &objectName );
-    static void deleteTriggers( const QString &objectName, const QString &signalName );
 };
 
 } // namespace OpenForm
@@ -0,0 +1,61 @@
+/**
+ * VaL::bOK <valbok@gmail.com>
+ * Created on: <10-Jun-2009 11:00:54 VaL>
+ *
+ * COPYRIGHT NOTICE: Copyright (C) 2009 VaL::bOK
+ * SOFTWARE LICENSE: GNU General Public License v2.0
+ */
+
+#include "uiparser.h"
+#include "uiloader.h"
+#include "preprocessor.h"
+#include <QtCore/QMetaObject>
+
+using namespace OpenForm;
+
+UiParser::UiParser( const QString &data, const QString &workingDirectory, QObject *receiver, const char *member ):
+ Data( data ), WorkingDirectory( workingDirectory ), Receiver( receiver ), Member( member ), Ui( 0 ), Update( false ), Finished( 0 )
+{
+    // Parser is owned by the receiver
+    this->setAutoDelete( false );
+}
+
+/**
+ * Preprocesses and parses the document, does not touch any widgets
+ */
+void UiParser::run()
+{
+    // Device has its own include list, so documents can be parsed at the same time.
+    // Current directory is shared by all forms, so includes are searched in the form's one
+    PreProcessorDevice device( this->Data );
+    device.setWorkingDirectory( this->WorkingDirectory );
+    QXmlStreamReader reader;
+    reader.setDevice( &device );
+
+    this->Ui = UiLoader::read( reader, &this->Update );
+    this->Finished.fetchAndStoreRelease( 1 );
+
+    if ( this->Receiver )
+    {
+        QMetaObject::invokeMethod( this->Receiver, this->Member, Qt::QueuedConnection );
+    }
+}
+
+/**
+ * Checks if parsing is finished
+ */
+bool UiParser::isFinished() const
+{
+    return const_cast< QAtomicInt& >( this->Finished ).testAndSetAcquire( 1, 1 );
+}
+
+/**
+ * Returns parsed document and passes ownership of it to caller
+ */
+DomUI *UiParser::takeUi()
+{
+    DomUI *ui = this->Ui;
+    this->Ui = 0;
+
+    return ui;
+}
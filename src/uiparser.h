@@ -0,0 +1,77 @@
+/**
+ * VaL::bOK <valbok@gmail.com>
+ * Created on: <10-Jun-2009 11:00:54 VaL>
+ *
+ * COPYRIGHT NOTICE: Copyright (C) 2009 VaL::bOK
+ * SOFTWARE LICENSE: GNU General Public License v2.0
+ */
+
+#ifndef UIPARSER_H
+#define UIPARSER_H
+
+#include <QtCore/QRunnable>
+#include <QtCore/QAtomicInt>
+#include <QtCore/QObject>
+#include <QtCore/QString>
+#include "ui4_p.h"
+
+namespace OpenForm
+{
+
+/**
+ * This class contains methods to preprocess and parse UI document in a worker thread.
+ *
+ * Parsed DomUI is taken by GUI thread to create widgets,
+ * \a Receiver's slot \a Member is invoked by queued connection when parsing is finished.
+ */
+class UiParser: public QRunnable
+{
+    /**
+     * Document that should be parsed
+     */
+    const QString Data;
+
+    /**
+     * Directory where included files are searched
+     */
+    const QString WorkingDirectory;
+
+    /**
+     * Object that is notified when parsing is finished, it must wait for the parser before being deleted
+     */
+    QObject *Receiver;
+
+    /**
+     * Slot name of \a Receiver without arguments
+     */
+    const char *Member;
+
+    /**
+     * Parsed document, 0 if it is not parsed yet or has errors
+     */
+    DomUI *Ui;
+
+    /**
+     * If the document is <update>
+     */
+    bool Update;
+
+    /**
+     * Non zero when parsing is finished
+     */
+    QAtomicInt Finished;
+
+public:
+    UiParser( const QString &data, const QString &workingDirectory, QObject *receiver, const char *member );
+    virtual ~UiParser() { delete this->Ui; }
+
+    virtual void run();
+
+    bool isFinished() const;
+    bool isUpdate() const { return this->Update; }
+    DomUI *takeUi();
+};
+
+} // namespace OpenForm
+
+#endif // UIPARSER_H
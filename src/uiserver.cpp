@@ -0,0 +1,344 @@
+/**
+ * VaL::bOK <valbok@gmail.com>
+ * Created on: <10-Jun-2009 11:00:54 VaL>
+ *
+ * COPYRIGHT NOTICE: Copyright (C) 2009 VaL::bOK
+ * SOFTWARE LICENSE: GNU General Public License v2.0
+ */
+
+#include "uiserver.h"
+#include "windowhandler.h"
+#include <QtCore/QDataStream>
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <errno.h>
+#include <unistd.h>
+
+using namespace OpenForm;
+
+/**
+ * Time in msecs to wait for running daemon
+ */
+static const int CONNECT_TIMEOUT = 1000;
+
+UiSessionOutput::UiSessionOutput( QLocalSocket *socket, quint8 type, QObject *parent ): QIODevice( parent ), Socket( socket ), Type( type )
+{
+    this->open( QIODevice::WriteOnly );
+}
+
+/**
+ * Sends written data to the client
+ */
+qint64 UiSessionOutput::writeData( const char *data, qint64 size )
+{
+    UiSession::writeFrame( this->Socket, this->Type, QByteArray( data, (int) size ) );
+
+    return size;
+}
+
+UiSession::UiSession( QLocalSocket *socket, QObject *parent ): QObject( parent ), Socket( socket ), Window( 0 ),
+ Output( socket, Daemon::OUTPUT ), ErrorOutput( socket, Daemon::ERROR_OUTPUT ), RequestSize( -1 )
+{
+    this->Socket->setParent( this );
+
+    connect( this->Socket, SIGNAL( readyRead() ), this, SLOT( readRequest() ) );
+    // Form is closed when the client is gone
+    connect( this->Socket, SIGNAL( disconnected() ), this, SLOT( deleteLater() ) );
+
+    this->readRequest();
+}
+
+UiSession::~UiSession()
+{
+    delete this->Window;
+}
+
+/**
+ * Reads request of the client when it is completely received
+ */
+void UiSession::readRequest()
+{
+    QDataStream stream( this->Socket );
+
+    if ( this->RequestSize < 0 )
+    {
+        if ( this->Socket->bytesAvailable() < (qint64) sizeof( quint32 ) )
+        {
+            return;
+        }
+
+        quint32 size = 0;
+        stream >> size;
+        this->RequestSize = size;
+    }
+
+    if ( this->Socket->bytesAvailable() < this->RequestSize )
+    {
+        return;
+    }
+
+    // Only one request is handled by session
+    disconnect( this->Socket, SIGNAL( readyRead() ), this, SLOT( readRequest() ) );
+    this->handleRequest( this->Socket->read( this->RequestSize ) );
+}
+
+/**
+ * Loads the form requested by the client
+ */
+void UiSession::handleRequest( const QByteArray &request )
+{
+    QDataStream stream( request );
+    quint32 protocol = 0;
+    QString workingDirectory;
+    QString fileName;
+    QByteArray input;
+    bool useCache = true;
+    QStringList environment;
+
+    stream >> protocol;
+    if ( protocol != Daemon::PROTOCOL )
+    {
+        this->sendError( "Unsupported protocol of client\n" );
+        this->finish( 1 );
+        return;
+    }
+
+    stream >> workingDirectory >> fileName >> input >> useCache >> environment;
+
+    // Included files and commands are searched relatively to the directory of the client,
+    // current directory of the daemon is shared by all forms and is not changed.
+    // Commands get environment of the client like they do when the form is shown by the client itself.
+    if ( fileName.isEmpty() )
+    {
+        this->Window = new WindowHandler( QString::fromUtf8( input.constData(), input.size() ), workingDirectory, environment );
+    }
+    else
+    {
+        QFile file( fileName );
+        if ( !file.open( QFile::ReadOnly | QFile::Text ) )
+        {
+            this->sendError( QString( "The file '%1' could not be opened\n" ).arg( fileName ) );
+            this->finish( 2 );
+            return;
+        }
+
+        this->Window = new WindowHandler( file, useCache, workingDirectory, environment );
+    }
+
+    if ( !this->Window->hasUi() )
+    {
+        fileName = !fileName.isEmpty() ? "file '" + fileName + "'" : "<stdin>";
+        this->sendError( QString( "Could not load widget from %1\n" ).arg( fileName ) );
+        this->finish( 4 );
+        return;
+    }
+
+    this->Window->setOutput( &this->Output );
+    this->Window->setErrorOutput( &this->ErrorOutput );
+    connect( this->Window, SIGNAL( closed() ), this, SLOT( closed() ) );
+    this->Window->show();
+}
+
+/**
+ * Sends \a error to stderr of the client
+ */
+void UiSession::sendError( const QString &error )
+{
+    this->ErrorOutput.write( error.toLocal8Bit() );
+}
+
+/**
+ * Sends \a exitCode to the client and finishes the session
+ */
+void UiSession::finish( int exitCode )
+{
+    UiSession::writeFrame( this->Socket, Daemon::EXIT, QByteArray::number( exitCode ) );
+    this->Socket->flush();
+    this->Socket->disconnectFromServer();
+
+    this->deleteLater();
+}
+
+/**
+ * Form is closed like the last window of standalone application
+ */
+void UiSession::closed()
+{
+    this->finish( 0 );
+}
+
+/**
+ * Writes frame of \a type with \a data to \a socket
+ */
+void UiSession::writeFrame( QLocalSocket *socket, quint8 type, const QByteArray &data )
+{
+    QByteArray block;
+    QDataStream stream( &block, QIODevice::WriteOnly );
+    stream << quint32( 0 ) << type << data;
+    stream.device()->seek( 0 );
+    stream << quint32( block.size() - sizeof( quint32 ) );
+
+    socket->write( block );
+}
+
+UiServer::UiServer( QObject *parent ): QObject( parent )
+{
+    connect( &this->Server, SIGNAL( newConnection() ), this, SLOT( newConnection() ) );
+}
+
+/**
+ * Starts listening for clients.
+ * Returns false if the daemon is already running or the socket could not be created.
+ */
+bool UiServer::listen()
+{
+    return UiServer::listen( this->Server, UiServer::serverName() );
+}
+
+/**
+ * Starts listening \a name by \a server, socket left by crashed process of the user is removed.
+ * The socket is accessible only by the user, clients of other users are rejected by isPeerTrusted() anyway.
+ * Returns false if the socket is used by running process, \a name is not a socket of the user or could not be created.
+ */
+bool UiServer::listen( QLocalServer &server, const QString &name )
+{
+    if ( name.isEmpty() )
+    {
+        return false;
+    }
+
+    QLocalSocket socket;
+    socket.connectToServer( name );
+    if ( socket.waitForConnected( CONNECT_TIMEOUT ) )
+    {
+        fprintf( stderr, "The socket '%s' is already used by running process\n", name.toLocal8Bit().constData() );
+        return false;
+    }
+
+    // Names without '/' are created in temporary directory like QLocalServer does
+    const QString path = name.startsWith( '/' ) ? name : QDir::tempPath() + '/' + name;
+    const QByteArray encodedPath = QFile::encodeName( path );
+
+    // Only stale socket of the user is removed, the name could be a regular file by mistake
+    struct stat info;
+    if ( ::lstat( encodedPath.constData(), &info ) == 0 )
+    {
+        if ( !S_ISSOCK( info.st_mode ) || info.st_uid != ::getuid() )
+        {
+            fprintf( stderr, "Could not listen '%s': the file exists and is not a socket of the user\n", name.toLocal8Bit().constData() );
+            return false;
+        }
+
+        ::unlink( encodedPath.constData() );
+    }
+
+    // Socket is created without permissions for others, so it is never accessible by them
+    const mode_t mask = ::umask( S_IRWXG | S_IRWXO );
+    const bool listening = server.listen( name );
+    ::umask( mask );
+
+    if ( !listening )
+    {
+        fprintf( stderr, "Could not listen '%s': %s\n", name.toLocal8Bit().constData(), server.errorString().toLocal8Bit().constData() );
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * Checks if process on the other side of \a socket belongs to the same user
+ */
+bool UiServer::isPeerTrusted( QLocalSocket *socket )
+{
+    int fd = (int) socket->socketDescriptor();
+    if ( fd < 0 )
+    {
+        return false;
+    }
+
+#ifdef SO_PEERCRED
+    struct ucred credentials;
+    socklen_t size = sizeof( credentials );
+    if ( ::getsockopt( fd, SOL_SOCKET, SO_PEERCRED, &credentials, &size ) != 0 )
+    {
+        return false;
+    }
+
+    return credentials.uid == ::getuid();
+#else
+    uid_t uid = 0;
+    gid_t gid = 0;
+    if ( ::getpeereid( fd, &uid, &gid ) != 0 )
+    {
+        return false;
+    }
+
+    return uid == ::getuid();
+#endif
+}
+
+/**
+ * Starts session for each new client, clients of other users are disconnected
+ */
+void UiServer::newConnection()
+{
+    while ( this->Server.hasPendingConnections() )
+    {
+        QLocalSocket *socket = this->Server.nextPendingConnection();
+        if ( !UiServer::isPeerTrusted( socket ) )
+        {
+            fprintf( stderr, "Connection of other user is rejected\n" );
+            socket->abort();
+            socket->deleteLater();
+            continue;
+        }
+
+        new UiSession( socket, this );
+    }
+}
+
+/**
+ * Checks if \a path is a directory that only the user can access
+ */
+static bool isPrivateDirectory( const QString &path )
+{
+    struct stat info;
+    if ( ::lstat( QFile::encodeName( path ).constData(), &info ) != 0 )
+    {
+        return false;
+    }
+
+    return S_ISDIR( info.st_mode ) && info.st_uid == ::getuid() && ( info.st_mode & ( S_IRWXG | S_IRWXO ) ) == 0;
+}
+
+/**
+ * Returns path of the daemon socket: $XDG_RUNTIME_DIR/openform-daemon,
+ * or <temp>/openform-<uid>/openform-daemon if the runtime directory is not available.
+ * The directory in temp is created with 0700 mode, empty string is returned if it is not owned by the user.
+ */
+QString UiServer::serverName()
+{
+    QString dir = QString::fromLocal8Bit( qgetenv( "XDG_RUNTIME_DIR" ) );
+    if ( dir.isEmpty() || !isPrivateDirectory( dir ) )
+    {
+        dir = QDir( QDir::tempPath() ).filePath( "openform-" + QString::number( ::getuid() ) );
+        if ( ::mkdir( QFile::encodeName( dir ).constData(), S_IRWXU ) != 0 && errno != EEXIST )
+        {
+            return QString();
+        }
+
+        // Directory could be created by other user before
+        if ( !isPrivateDirectory( dir ) )
+        {
+            fprintf( stderr, "The directory '%s' is not private, daemon socket could not be used\n", dir.toLocal8Bit().constData() );
+            return QString();
+        }
+    }
+
+    return QDir( dir ).filePath( "openform-daemon" );
+}
@@ -0,0 +1,151 @@
+/**
+ * VaL::bOK <valbok@gmail.com>
+ * Created on: <10-Jun-2009 11:00:54 VaL>
+ *
+ * COPYRIGHT NOTICE: Copyright (C) 2009 VaL::bOK
+ * SOFTWARE LICENSE: GNU General Public License v2.0
+ */
+
+#ifndef UISERVER_H
+#define UISERVER_H
+
+#include <QtCore/QObject>
+#include <QtCore/QIODevice>
+#include <QtCore/QString>
+#include <QtNetwork/QLocalServer>
+#include <QtNetwork/QLocalSocket>
+
+namespace OpenForm
+{
+
+class WindowHandler;
+
+/**
+ * Protocol between daemon and clients.
+ *
+ * Each message is a block prefixed by its size ( quint32 ) and serialized by QDataStream.
+ * Client sends one request: PROTOCOL, working directory, absolute UI file name or empty for stdin,
+ * stdin data, use cache flag, environment of the client as "NAME=value" entries.
+ * Both sides accept only peers of the same user, the socket is in a directory available only for the user.
+ * Daemon replies by frames of the same format: frame type ( quint8 ) followed by data ( QByteArray ),
+ * exit code is sent as text.
+ */
+namespace Daemon
+{
+    const quint32 PROTOCOL = 2;
+
+    /**
+     * Data for client's stdout
+     */
+    const quint8 OUTPUT = 'o';
+
+    /**
+     * Data for client's stderr
+     */
+    const quint8 ERROR_OUTPUT = 'e';
+
+    /**
+     * Exit code of the form, it is the last frame
+     */
+    const quint8 EXIT = 'x';
+
+}; // namespace Daemon
+
+/**
+ * Output of a form that is sent to stdout or stderr of the client
+ */
+class UiSessionOutput: public QIODevice
+{
+    /**
+     * Connection to the client
+     */
+    QLocalSocket *Socket;
+
+    /**
+     * Type of frames the data is sent by, Daemon::OUTPUT or Daemon::ERROR_OUTPUT
+     */
+    const quint8 Type;
+
+protected:
+    qint64 readData( char *, qint64 ) { return -1; }
+    qint64 writeData( const char *data, qint64 size );
+
+public:
+    UiSessionOutput( QLocalSocket *socket, quint8 type, QObject *parent = 0 );
+
+    bool isSequential() const { return true; }
+};
+
+/**
+ * This class contains methods to show a form requested by a client and to return its result
+ */
+class UiSession: public QObject
+{
+    Q_OBJECT
+
+    /**
+     * Connection to the client, it is deleted with the session
+     */
+    QLocalSocket *Socket;
+
+    /**
+     * Form of the client
+     */
+    WindowHandler *Window;
+
+    /**
+     * Output of the form
+     */
+    UiSessionOutput Output;
+
+    /**
+     * Errors of the form and its commands
+     */
+    UiSessionOutput ErrorOutput;
+
+    /**
+     * Size of the request, -1 if it is not read yet
+     */
+    qint64 RequestSize;
+
+    void handleRequest( const QByteArray &request );
+    void sendError( const QString &error );
+    void finish( int exitCode );
+
+private slots:
+    void readRequest();
+    void closed();
+
+public:
+    UiSession( QLocalSocket *socket, QObject *parent = 0 );
+    ~UiSession();
+
+    static void writeFrame( QLocalSocket *socket, quint8 type, const QByteArray &data );
+};
+
+/**
+ * This class contains methods to keep GUI initialized and to show forms requested by clients
+ */
+class UiServer: public QObject
+{
+    Q_OBJECT
+
+    QLocalServer Server;
+
+private slots:
+    void newConnection();
+
+public:
+    UiServer( QObject *parent = 0 );
+    ~UiServer() {}
+
+    bool listen();
+
+    static bool listen( QLocalServer &server, const QString &name );
+    static bool isPeerTrusted( QLocalSocket *socket );
+    static QString serverName();
+};
+
+} // namespace OpenForm
+
+#endif // UISERVER_H
@@ -0,0 +1,144 @@
+/**
+ * VaL::bOK <valbok@gmail.com>
+ * Created on: <10-Jun-2009 11:00:54 VaL>
+ *
+ * COPYRIGHT NOTICE: Copyright (C) 2009 VaL::bOK
+ * SOFTWARE LICENSE: GNU General Public License v2.0
+ */
+
+#include "uistream.h"
+#include "windowhandler.h"
+#include "inputcommandparser.h"
+#include <QtCore/QCoreApplication>
+#include <unistd.h>
+#include <errno.h>
+
+using namespace OpenForm;
+
+/**
+ * Size of data that is read from stdin at once
+ */
+static const int READ_SIZE = 16384;
+
+UiStream::UiStream( QObject *parent ): QObject( parent ), Window( 0 ), Notifier( STDIN_FILENO, QSocketNotifier::Read ), HasPendingQuery( false )
+{
+    connect( &this->Notifier, SIGNAL( activated( int ) ), this, SLOT( readData() ) );
+}
+
+UiStream::~UiStream()
+{
+    delete this->Window;
+}
+
+/**
+ * Reads available data from stdin without blocking and handles received documents
+ */
+void UiStream::readData()
+{
+    char data[READ_SIZE];
+    ssize_t size = ::read( STDIN_FILENO, data, READ_SIZE );
+    if ( size < 0 && ( errno == EAGAIN || errno == EINTR ) )
+    {
+        return;
+    }
+
+    if ( size <= 0 )
+    {
+        this->Notifier.setEnabled( false );
+
+        if ( !this->Splitter.isEmpty() )
+        {
+            fprintf( stderr, "Unfinished document is ignored at the end of <stdin>\n" );
+        }
+
+        if ( !this->Window )
+        {
+            fprintf( stderr, "Could not load widget from <stdin>\n" );
+            QCoreApplication::exit( 4 );
+        }
+
+        return;
+    }
+
+    this->Splitter.append( QByteArray( data, size ) );
+    this->handleItems();
+}
+
+/**
+ * Handles received items until a query should wait for previous documents
+ */
+void UiStream::handleItems()
+{
+    DocumentSplitter::ItemType type;
+    QByteArray item;
+    while ( !this->HasPendingQuery && this->Splitter.next( &type, &item ) )
+    {
+        this->handle( type, item );
+    }
+}
+
+/**
+ * Answers the query that waits for applied documents and continues handling received items
+ */
+void UiStream::answerPendingQuery()
+{
+    if ( !this->HasPendingQuery )
+    {
+        return;
+    }
+
+    this->HasPendingQuery = false;
+    this->answer( this->PendingQuery );
+    this->PendingQuery.clear();
+    this->handleItems();
+}
+
+/**
+ * Writes result of \a query to stdout
+ */
+void UiStream::answer( const QByteArray &query )
+{
+    InputCommandParser parser( this->Window ? this->Window->getWidget() : 0 );
+    fprintf( stdout, "%s\n", parser.parse( QString::fromUtf8( query.constData(), query.size() ) ).toLocal8Bit().constData() );
+    fflush( stdout );
+}
+
+/**
+ * Shows the form by the first document, applies next ones and answers queries
+ */
+void UiStream::handle( DocumentSplitter::ItemType type, const QByteArray &item )
+{
+    if ( type == DocumentSplitter::Query )
+    {
+        // Documents are parsed in worker thread and applied later
+        if ( this->Window && this->Window->hasPendingUpdates() )
+        {
+            this->PendingQuery = item;
+            this->HasPendingQuery = true;
+            return;
+        }
+
+        this->answer( item );
+        return;
+    }
+
+    QString data = QString::fromUtf8( item.constData(), item.size() );
+    if ( this->Window )
+    {
+        this->Window->setUiFrom( data );
+        return;
+    }
+
+    this->Window = new WindowHandler( data );
+    if ( !this->Window->hasUi() )
+    {
+        // Only <ui> could be shown first, next document might be correct
+        delete this->Window;
+        this->Window = 0;
+        fprintf( stderr, "Could not load widget from <stdin>\n" );
+        return;
+    }
+
+    connect( this->Window, SIGNAL( updatesApplied() ), this, SLOT( answerPendingQuery() ) );
+    this->Window->show();
+}
@@ -0,0 +1,66 @@
+/**
+ * VaL::bOK <valbok@gmail.com>
+ * Created on: <10-Jun-2009 11:00:54 VaL>
+ *
+ * COPYRIGHT NOTICE: Copyright (C) 2009 VaL::bOK
+ * SOFTWARE LICENSE: GNU General Public License v2.0
+ */
+
+#ifndef UISTREAM_H
+#define UISTREAM_H
+
+#include <QtCore/QObject>
+#include <QtCore/QSocketNotifier>
+#include "documentsplitter.h"
+
+namespace OpenForm
+{
+
+class WindowHandler;
+
+/**
+ * This class contains methods to show a form from stdin and to apply documents that follow it.
+ *
+ * The form is shown as soon as the first document is received, next <ui> or <update> documents
+ * are applied when each of them is received. Queries like "?{edit.text}" are answered to stdout
+ * when documents received before them are applied.
+ */
+class UiStream: public QObject
+{
+    Q_OBJECT
+
+    /**
+     * Form created by the first document
+     */
+    WindowHandler *Window;
+
+    /**
+     * Notifies when stdin can be read
+     */
+    QSocketNotifier Notifier;
+
+    DocumentSplitter Splitter;
+
+    /**
+     * Query that waits until previously received documents are applied,
+     * next items are not handled until it is answered
+     */
+    QByteArray PendingQuery;
+    bool HasPendingQuery;
+
+    void handleItems();
+    void handle( DocumentSplitter::ItemType type, const QByteArray &item );
+    void answer( const QByteArray &query );
+
+private slots:
+    void readData();
+    void answerPendingQuery();
+
+public:
+    UiStream( QObject *parent = 0 );
+    ~UiStream();
+};
+
+} // namespace OpenForm
+
+#endif // UISTREAM_H
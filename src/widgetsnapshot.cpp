@@ -0,0 +1,236 @@
+/**
+ * VaL::bOK <valbok@gmail.com>
+ * Created on: <10-Jun-2009 11:00:54 VaL>
+ *
+ * COPYRIGHT NOTICE: Copyright (C) 2009 VaL::bOK
+ * SOFTWARE LICENSE: GNU General Public License v2.0
+ */
+
+#include "widgetsnapshot.h"
+#include <QtCore/QHash>
+#include <QtCore/QMetaProperty>
+#include <QtCore/QPair>
+#include <QtCore/qnumeric.h>
+
+using namespace OpenForm;
+
+/**
+ * Sets \a format by its \a name: "keyvalue" or "json".
+ * Returns false if the format is not supported.
+ */
+bool WidgetSnapshot::formatByName( const QString &name, Format *format )
+{
+    if ( name == QLatin1String( "keyvalue" ) )
+    {
+        *format = KeyValue;
+        return true;
+    }
+
+    if ( name == QLatin1String( "json" ) )
+    {
+        *format = Json;
+        return true;
+    }
+
+    return false;
+}
+
+/**
+ * Collects values of widgets with \a names ( or all named widgets if \a names is empty ) of \a topLevel.
+ * Values are ordered like \a names or like widgets in the tree, a name listed several times is returned once.
+ * All named widgets do not include internal children of Qt widgets like "qt_spinbox_lineedit",
+ * only the first of widgets with the same name is used.
+ */
+QByteArray WidgetSnapshot::collect( QWidget *topLevel, const QStringList &names, Format format )
+{
+    typedef QPair< QString, QVariant > Value;
+
+    QList< Value > values;
+    if ( !topLevel )
+    {
+        return QByteArray();
+    }
+
+    const bool all = names.isEmpty();
+    QHash< QString, int > positions;
+    QStringList requested;
+    for ( int i = 0; i < names.size(); ++i )
+    {
+        if ( positions.contains( names.at( i ) ) )
+        {
+            continue;
+        }
+
+        positions.insert( names.at( i ), requested.size() );
+        requested.append( names.at( i ) );
+        values.append( Value() );
+    }
+
+    QList< QWidget* > widgets = topLevel->findChildren< QWidget* >();
+    widgets.prepend( topLevel );
+
+    for ( int i = 0; i < widgets.size(); ++i )
+    {
+        QWidget *widget = widgets.at( i );
+        const QString name = widget->objectName();
+        if ( name.isEmpty() || ( !all && !positions.contains( name ) ) )
+        {
+            continue;
+        }
+
+        const QMetaProperty property = widget->metaObject()->userProperty();
+        if ( !property.isValid() )
+        {
+            if ( !all )
+            {
+                fprintf( stderr, "Widget '%s' does not have user property\n", name.toLocal8Bit().constData() );
+            }
+
+            continue;
+        }
+
+        if ( all )
+        {
+            if ( name.startsWith( "qt_" ) || positions.contains( name ) )
+            {
+                continue;
+            }
+
+            positions.insert( name, values.size() );
+            values.append( Value( name, property.read( widget ) ) );
+        }
+        else if ( values[positions[name]].first.isNull() )
+        {
+            values[positions[name]] = Value( name, property.read( widget ) );
+        }
+    }
+
+    QByteArray result;
+    QStringList jsonItems;
+    for ( int i = 0; i < values.size(); ++i )
+    {
+        const Value &value = values.at( i );
+        if ( value.first.isNull() )
+        {
+            fprintf( stderr, "Could not find widget by name '%s'\n", requested.at( i ).toLocal8Bit().constData() );
+            continue;
+        }
+
+        if ( format == Json )
+        {
+            jsonItems.append( WidgetSnapshot::toJsonString( value.first ) + ":" + WidgetSnapshot::toJson( value.second ) );
+            continue;
+        }
+
+        const QString text = value.second.type() == QVariant::StringList ? value.second.toStringList().join( "\n" ) : value.second.toString();
+        result.append( value.first.toUtf8() );
+        result.append( '=' );
+        result.append( WidgetSnapshot::escapeValue( text ) );
+        result.append( '\n' );
+    }
+
+    if ( format == Json )
+    {
+        result = ( "{" + jsonItems.join( "," ) + "}\n" ).toUtf8();
+    }
+
+    return result;
+}
+
+/**
+ * Escapes new lines and '\' of \a value for "name=value" lines
+ */
+QByteArray WidgetSnapshot::escapeValue( const QString &value )
+{
+    QByteArray result = value.toUtf8();
+    result.replace( '\\', "\\\\" );
+    result.replace( '\n', "\\n" );
+    result.replace( '\r', "\\r" );
+
+    return result;
+}
+
+/**
+ * Returns JSON representation of \a value
+ */
+QString WidgetSnapshot::toJson( const QVariant &value )
+{
+    switch ( value.type() )
+    {
+        case QVariant::Invalid:
+        {
+            return "null";
+        } break;
+
+        case QVariant::Bool:
+        {
+            return value.toBool() ? "true" : "false";
+        } break;
+
+        case QVariant::Int:
+        case QVariant::UInt:
+        case QVariant::LongLong:
+        case QVariant::ULongLong:
+        {
+            return value.toString();
+        } break;
+
+        case QVariant::Double:
+        {
+            // JSON has no NaN or infinity, 17 digits keep the value exact
+            const double number = value.toDouble();
+            return qIsFinite( number ) ? QString::number( number, 'g', 17 ) : QString( "null" );
+        } break;
+
+        case QVariant::StringList:
+        case QVariant::List:
+        {
+            QStringList items;
+            const QVariantList list = value.toList();
+            for ( int i = 0; i < list.size(); ++i )
+            {
+                items.append( WidgetSnapshot::toJson( list.at( i ) ) );
+            }
+
+            return "[" + items.join( "," ) + "]";
+        } break;
+
+        default:
+        {
+            return WidgetSnapshot::toJsonString( value.toString() );
+        } break;
+    }
+}
+
+/**
+ * Returns \a value as quoted and escaped JSON string
+ */
+QString WidgetSnapshot::toJsonString( const QString &value )
+{
+    QString result = "\"";
+    for ( int i = 0; i < value.length(); ++i )
+    {
+        const QChar c = value.at( i );
+        switch ( c.unicode() )
+        {
+            case '"':  result += "\\\""; break;
+            case '\\': result += "\\\\"; break;
+            case '\n': result += "\\n"; break;
+            case '\r': result += "\\r"; break;
+            case '\t': result += "\\t"; break;
+            default:
+            {
+                if ( c.unicode() < 0x20 )
+                {
+                    result += QString( "\\u%1" ).arg( c.unicode(), 4, 16, QChar( '0' ) );
+                }
+                else
+                {
+                    result += c;
+                }
+            } break;
+        }
+    }
+
+    return result + "\"";
+}
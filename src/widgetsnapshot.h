@@ -0,0 +1,55 @@
+/**
+ * VaL::bOK <valbok@gmail.com>
+ * Created on: <10-Jun-2009 11:00:54 VaL>
+ *
+ * COPYRIGHT NOTICE: Copyright (C) 2009 VaL::bOK
+ * SOFTWARE LICENSE: GNU General Public License v2.0
+ */
+
+#ifndef WIDGETSNAPSHOT_H
+#define WIDGETSNAPSHOT_H
+
+#include <QtGui/QWidget>
+#include <QtCore/QByteArray>
+#include <QtCore/QString>
+#include <QtCore/QStringList>
+#include <QtCore/QVariant>
+
+namespace OpenForm
+{
+
+/**
+ * This class contains methods to collect values of widgets in one pass over widget tree.
+ *
+ * Value of a widget is its user property, e.g. text of QLineEdit or checked state of QCheckBox.
+ */
+class WidgetSnapshot
+{
+    static QByteArray escapeValue( const QString &value );
+
+public:
+    /**
+     * Supported formats of snapshot
+     */
+    enum Format
+    {
+        /**
+         * "name=value" lines, new lines and '\' in values are escaped by '\'
+         */
+        KeyValue,
+
+        /**
+         * JSON object with values by names
+         */
+        Json
+    };
+
+    static bool formatByName( const QString &name, Format *format );
+    static QByteArray collect( QWidget *topLevel, const QStringList &names, Format format );
+    static QString toJson( const QVariant &value );
+    static QString toJsonString( const QString &value );
+};
+
+} // namespace OpenForm
+
+#endif // WIDGETSNAPSHOT_H
@@ -9,24 +9,126 @@
 #include "windowhandler.h"
 #include "uiloader.h"
 #include "preprocessor.h"
-#include <QBuffer>
+#include "uicache.h"
+#include "uiparser.h"
+#include "trigger.h"
+#include "signaldispatcher.h"
+#include "callhandler.h"
+#include <QtCore/QDir>
+#include <QtCore/QScopedPointer>
 
 using namespace OpenForm;
 
-WindowHandler::WindowHandler( QFile &file ): Widget( 0 )
+/**
+ * Included files and commands are searched in \a workingDirectory, or in current directory if it is empty.
+ * Commands get \a environment, or environment of the application if it is empty.
+ */
+WindowHandler::WindowHandler( QFile &file, bool useCache, const QString &workingDirectory, const QStringList &environment ):
+ Widget( 0 ), WorkingDirectory( workingDirectory.isEmpty() ? QDir::currentPath() : workingDirectory ), Environment( environment ), Output( 0 ), ErrorOutput( 0 )
+{
+    this->Dispatcher = new SignalDispatcher( this );
+    this->parseUiFrom( file, useCache );
+}
+
+WindowHandler::WindowHandler( const QString &data, const QString &workingDirectory, const QStringList &environment ):
+ Widget( 0 ), WorkingDirectory( workingDirectory.isEmpty() ? QDir::currentPath() : workingDirectory ), Environment( environment ), Output( 0 ), ErrorOutput( 0 )
 {
-    this->parseUiFrom( file );
+    this->Dispatcher = new SignalDispatcher( this );
+    this->parseUiFrom( data );
+}
+
+WindowHandler::~WindowHandler()
+{
+    // Parsers notify this object, so they must be finished before
+    this->ParserPool.waitForDone();
+    qDeleteAll( this->ParserQueue );
+
+    // Triggers are disconnected and running commands are killed
+    delete this->Dispatcher;
+    qDeleteAll( this->CallHandlers );
+    WindowHandler::deleteWidget( this->Widget );
 }
 
 /**
- * Parses UI from file
+ * Installs \a trigger for \a signalName of \a object, previous one for \a objectName and \a signalName is deleted
  */
-void WindowHandler::parseUiFrom( QFile &file )
+void WindowHandler::setTrigger( QObject *object, const QString &objectName, const QString &signalName, const Trigger &trigger )
 {
-    PreProcessor preProcessor;
+    this->Dispatcher->setTrigger( object, objectName, signalName, trigger );
+}
 
+/**
+ * Deletes all triggers of this UI
+ */
+void WindowHandler::deleteTriggers()
+{
+    this->Dispatcher->deleteTriggers();
+}
+
+/**
+ * Deletes triggers by \a objectName
+ */
+void WindowHandler::deleteTriggers( const QString &objectName )
+{
+    this->Dispatcher->deleteTriggers( objectName );
+}
+
+/**
+ * Deletes triggers by \a objectName and its \a signalName
+ */
+void WindowHandler::deleteTriggers( const QString &objectName, const QString &signalName )
+{
+    this->Dispatcher->deleteTriggers( objectName, signalName );
+}
+
+/**
+ * Parses UI from file
+ *
+ * If \a useCache is true, preprocessed document is stored in cache
+ * and used instead of the file while neither it nor its includes are changed.
+ */
+void WindowHandler::parseUiFrom( QFile &file, bool useCache )
+{
     UiLoader loader( this );
-    this->setWidget( loader.load( preProcessor.process( &file ) ) );
+
+    // Stdin could not be cached
+    if ( !useCache || file.fileName().isEmpty() )
+    {
+        // Data is preprocessed while it is being parsed
+        PreProcessorDevice device( &file );
+        device.setWorkingDirectory( this->WorkingDirectory );
+        this->setWidget( loader.load( &device ) );
+        return;
+    }
+
+    UiCache cache( file.fileName() );
+
+    // Cached document does not need to be preprocessed
+    if ( QIODevice *cached = cache.load() )
+    {
+        this->setWidget( loader.load( cached ) );
+        cache.discard();
+
+        if ( this->hasUi() )
+        {
+            return;
+        }
+    }
+
+    PreProcessorDevice device( &file );
+    device.setWorkingDirectory( this->WorkingDirectory );
+    device.setCopy( cache.create() );
+    this->setWidget( loader.load( &device ) );
+
+    // Only completely read and loaded document is cached
+    if ( this->hasUi() && device.atEnd() )
+    {
+        cache.save( device.getIncludedFiles() );
+    }
+    else
+    {
+        cache.discard();
+    }
 }
 
 /**
@@ -34,10 +136,11 @@ void WindowHandler::parseUiFrom( QFile &file )
  */
 void WindowHandler::parseUiFrom( const QString &data )
 {
-    PreProcessor preProcessor;
+    PreProcessorDevice device( data );
+    device.setWorkingDirectory( this->WorkingDirectory );
 
     UiLoader loader( this );
-    this->setWidget( loader.load( preProcessor.process( data ) ) );
+    this->setWidget( loader.load( &device ) );
 }
 
 /**
@@ -45,24 +148,77 @@ void WindowHandler::parseUiFrom( const QString &data )
  */
 void WindowHandler::returnData( const QString &data ) const
 {
-    fprintf( stdout, "%s\n", data.toLocal8Bit().constData() );
+    if ( this->Output )
+    {
+        this->Output->write( data.toLocal8Bit() + '\n' );
+    }
+    else
+    {
+        fprintf( stdout, "%s\n", data.toLocal8Bit().constData() );
+    }
+
     emit this->Widget->close();
 }
 
+/**
+ * Prints \a message to stderr or to the device set by setErrorOutput()
+ */
+void WindowHandler::printError( const QString &message ) const
+{
+    if ( this->ErrorOutput )
+    {
+        this->ErrorOutput->write( message.toLocal8Bit() );
+    }
+    else
+    {
+        fprintf( stderr, "%s", message.toLocal8Bit().constData() );
+    }
+}
+
 /**
  * Updates current UI by new from text
+ *
+ * The text is preprocessed and parsed in worker thread,
+ * widgets are created by applyParsedUi() when it is done.
  */
 void WindowHandler::setUiFrom( const QString &data )
 {
-    PreProcessor preProcessor;
+    UiParser *parser = new UiParser( data, this->WorkingDirectory, this, "applyParsedUi" );
+    this->ParserQueue.append( parser );
+    this->ParserPool.start( parser );
+}
 
-    // Every time when we try to update existing Ui, need to clear include list
-    // to prevent errors about files are already included
-    PreProcessor::clearIncludeList();
+/**
+ * Creates widgets by parsed documents.
+ * Documents are applied in order they have been received even if later one is parsed first.
+ */
+void WindowHandler::applyParsedUi()
+{
+    while ( !this->ParserQueue.isEmpty() && this->ParserQueue.first()->isFinished() )
+    {
+        QScopedPointer< UiParser > parser( this->ParserQueue.takeFirst() );
+        QScopedPointer< DomUI > ui( parser->takeUi() );
+        if ( !ui )
+        {
+            continue;
+        }
 
-    UiLoader loader( this );
+        this->applyUi( ui.data(), parser->isUpdate() );
+    }
+
+    if ( this->ParserQueue.isEmpty() )
+    {
+        emit this->updatesApplied();
+    }
+}
 
-    QWidget *widget = loader.load( preProcessor.process( data ) );
+/**
+ * Creates new UI or updates current one by parsed \a ui
+ */
+void WindowHandler::applyUi( DomUI *ui, bool isUpdate )
+{
+    UiLoader loader( this );
+    QWidget *widget = loader.load( ui, isUpdate );
     if ( !widget )
     {
         return;
@@ -72,6 +228,62 @@ void WindowHandler::setUiFrom( const QString &data )
     this->show();
 }
 
+/**
+ * Registers native \a handler for triggers with action "call" by \a name.
+ * The handler is owned by this object, previous one with the same name is deleted.
+ */
+void WindowHandler::setCallHandler( const QString &name, CallHandler *handler )
+{
+    delete this->CallHandlers.take( name );
+    if ( handler )
+    {
+        this->CallHandlers.insert( name, handler );
+    }
+}
+
+/**
+ * Calls native handler \a name and applies its result.
+ * Returned document is applied later by setUiFrom(), the handler is called while the sender emits its signal,
+ * so the sender must not be deleted by new UI here.
+ */
+void WindowHandler::callHandler( const QString &name, const QStringList &arguments )
+{
+    CallHandler *handler = this->CallHandlers.value( name );
+    if ( !handler )
+    {
+        this->printError( QString( "Handler '%1' is not registered\n" ).arg( name ) );
+        return;
+    }
+
+    CallResult result;
+    handler->call( name, arguments, &result );
+
+    QMap< QString, QVariantMap >::const_iterator cend = result.Properties.constEnd();
+    for ( QMap< QString, QVariantMap >::const_iterator it = result.Properties.constBegin(); it != cend; ++it )
+    {
+        QObject *object = this->hasUi() ? UiLoader::objectByName( this->Widget, it.key() ) : 0;
+        if ( !object )
+        {
+            this->printError( QString( "%1: Could not find object by name '%2'\n" ).arg( name, it.key() ) );
+            continue;
+        }
+
+        QVariantMap::const_iterator propertyEnd = it.value().constEnd();
+        for ( QVariantMap::const_iterator propertyIt = it.value().constBegin(); propertyIt != propertyEnd; ++propertyIt )
+        {
+            if ( !object->setProperty( propertyIt.key().toLatin1(), propertyIt.value() ) )
+            {
+                this->printError( QString( "%1: Could not set property '%2' of '%3'\n" ).arg( name, propertyIt.key(), it.key() ) );
+            }
+        }
+    }
+
+    if ( !result.Document.isEmpty() )
+    {
+        this->setUiFrom( result.Document );
+    }
+}
+
 /**
  * Deletes widget
  */
@@ -93,6 +305,32 @@ void WindowHandler::setWidget( QWidget *widget )
     // Delete old widget
     WindowHandler::deleteWidget( this->Widget );
     this->Widget = widget;
+    this->Widget->installEventFilter( this );
+}
+
+/**
+ * Watches when UI widget is closed or hidden
+ */
+bool WindowHandler::eventFilter( QObject *object, QEvent *event )
+{
+    if ( object == this->Widget && ( event->type() == QEvent::Close || event->type() == QEvent::Hide ) )
+    {
+        // Close event might be ignored, so the widget is checked when the event is handled
+        QMetaObject::invokeMethod( this, "checkClosed", Qt::QueuedConnection );
+    }
+
+    return QObject::eventFilter( object, event );
+}
+
+/**
+ * Emits closed() if UI widget is not visible anymore
+ */
+void WindowHandler::checkClosed()
+{
+    if ( this->Widget && !this->Widget->isVisible() )
+    {
+        emit this->closed();
+    }
 }
 
 /**
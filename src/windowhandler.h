@@ -11,10 +11,20 @@
 
 #include <QtGui/QMainWindow>
 #include <QtCore/QFile>
+#include <QtCore/QList>
+#include <QtCore/QMap>
+#include <QtCore/QStringList>
+#include <QtCore/QThreadPool>
+#include "ui4_p.h"
 
 namespace OpenForm
 {
 
+class UiParser;
+class Trigger;
+class SignalDispatcher;
+class CallHandler;
+
 /**
  * This class contains methods to control UI
  */
@@ -27,20 +37,96 @@ class WindowHandler: public QObject
      */
     QWidget *Widget;
 
+    /**
+     * Directory where the UI has been loaded, included files and trigger commands are searched there
+     */
+    QString WorkingDirectory;
+
+    /**
+     * Environment of trigger commands as "NAME=value" entries, environment of the application if empty
+     */
+    QStringList Environment;
+
+    /**
+     * Device where returned data is written, stdout if 0
+     */
+    QIODevice *Output;
+
+    /**
+     * Device where errors of triggers and their commands are written, stderr if 0
+     */
+    QIODevice *ErrorOutput;
+
+    /**
+     * Receiver of signals of all triggers of this UI
+     */
+    SignalDispatcher *Dispatcher;
+
+    /**
+     * Native handlers of triggers with action "call" by names
+     */
+    QMap< QString, CallHandler* > CallHandlers;
+
+    /**
+     * Worker threads where documents returned by triggers are parsed
+     */
+    QThreadPool ParserPool;
+
+    /**
+     * Documents being parsed in order they have been received
+     */
+    QList< UiParser* > ParserQueue;
+
     static void deleteWidget( QWidget *widget );
     void setWidget( QWidget *widget );
+    void applyUi( DomUI *ui, bool isUpdate );
+protected:
+    bool eventFilter( QObject *object, QEvent *event );
+
 public:
-    WindowHandler( QFile &file );
-    virtual ~WindowHandler() { WindowHandler::deleteWidget( this->Widget ); }
+    WindowHandler( QFile &file, bool useCache = false, const QString &workingDirectory = QString(), const QStringList &environment = QStringList() );
+    WindowHandler( const QString &data, const QString &workingDirectory = QString(), const QStringList &environment = QStringList() );
+    virtual ~WindowHandler();
     bool hasUi() const;
+    bool hasPendingUpdates() const { return !this->ParserQueue.isEmpty(); }
     void show() const;
-    void parseUiFrom( QFile &file );
+    void parseUiFrom( QFile &file, bool useCache = false );
     void parseUiFrom( const QString &data );
     QWidget *getWidget() const { return this->Widget; }
+    QString getWorkingDirectory() const { return this->WorkingDirectory; }
+    QStringList getEnvironment() const { return this->Environment; }
+    void setOutput( QIODevice *output ) { this->Output = output; }
+    QIODevice *getErrorOutput() const { return this->ErrorOutput; }
+    void setErrorOutput( QIODevice *output ) { this->ErrorOutput = output; }
+    void printError( const QString &message ) const;
+
+    void setTrigger( QObject *object, const QString &objectName, const QString &signalName, const Trigger &trigger );
+    void deleteTriggers();
+    void deleteTriggers( const QString &objectName );
+    void deleteTriggers( const QString &objectName, const QString &signalName );
+
+    void setCallHandler( const QString &name, CallHandler *handler );
 
 public slots:
     void setUiFrom( const QString &data );
     void returnData( const QString &data ) const;
+    void callHandler( const QString &name, const QStringList &arguments );
+
+private slots:
+    void applyParsedUi();
+    void checkClosed();
+
+signals:
+
+    /**
+     * Emits when UI widget is closed or hidden
+     */
+    void closed();
+
+    /**
+     * Emits when all received documents are applied
+     */
+    void updatesApplied();
 };
 
 } // namespace OpenForm